@@ -0,0 +1,94 @@
+#include "shell.h"
+
+int replace_alias(shell_t *);
+int alias_expand(shell_t *, int, int *);
+int alias_splice(shell_t *, int, alias_t *);
+
+/**
+ * replace_alias - replaces the command name in the data->argv[0] argument
+ * with the words of the corresponding alias, if an alias exists for
+ *		that command, then the words after an alias whose value ends
+ *		with a blank, as sh does.
+ * @data: A pointer to the shell data structure
+ *	which contains information about the current state of the shell.
+ * Return: returns 1 if an alias was expanded, 0 if none was, -1 if memory
+ *		ran out.
+ */
+int replace_alias(shell_t *data)
+{
+	int i = 0, span, blank, expanded = 0;
+	char *word;
+
+	if (!data->alias || !data->alias->count)
+		return (0);
+	do {
+		word = data->argv[i];
+		span = alias_expand(data, i, &blank);
+		if (span == -1)
+			return (-1);
+		expanded |= span != 1 || data->argv[i] != word;
+		i += span;
+	} while (blank && i < data->argc);
+	return (expanded);
+}
+
+/**
+ * alias_expand - expands the word at an index if it is an alias that is
+ *		not already being expanded, then the first word of its value,
+ *		and so on: an alias that refers to itself stops there.
+ * @data: A pointer to the shell data structure
+ *	which contains information about the current state of the shell.
+ * @i: the index of the word in data->argv.
+ * @blank: receives non-zero when the word after the expansion is to be
+ *		checked for an alias too.
+ * Return: the number of words the word became, -1 if memory ran out.
+ */
+int alias_expand(shell_t *data, int i, int *blank)
+{
+	alias_t *a = alias_get(data, data->argv[i], _strlen(data->argv[i]));
+	int span, first, inner;
+
+	*blank = 0;
+	if (!a || a->active)
+		return (1);
+	if (alias_splice(data, i, a) == -1)
+		return (-1);
+	span = a->words.len - 1;
+	*blank = a->blank;
+	if (!span)
+		return (0);
+	a->active = 1;
+	first = alias_expand(data, i, &inner);
+	a->active = 0;
+	if (first == -1)
+		return (-1);
+	if (span == 1) /* the value is one word, whose own value ends it */
+		*blank |= inner;
+	return (span + first - 1);
+}
+
+/**
+ * alias_splice - replaces a word of the command with the words of an
+ *		alias, which stay the alias's own.
+ * @data: A pointer to the shell data structure
+ *	which contains information about the current state of the shell.
+ * @i: the index of the word in data->argv.
+ * @a: the alias.
+ * Return: 0 on success, -1 if memory ran out.
+ */
+int alias_splice(shell_t *data, int i, alias_t *a)
+{
+	size_t n = a->words.len - 1, len = data->args.len, k;
+	char **v;
+
+	for (k = 1; k < n; k++) /* room for the words past the first */
+		if (strvec_push(&data->args, NULL) == -1)
+			return (-1);
+	v = data->args.v;
+	memmove(v + i + n, v + i + 1, sizeof(char *) * (len - i - 1));
+	memcpy(v + i, a->words.v, sizeof(char *) * n);
+	data->args.len = len + n - 1;
+	data->argv = v;
+	data->argc += n - 1;
+	return (0);
+}
@@ -1,110 +1,131 @@
 #include "shell.h"
 
+int alias_builtin(shell_t *);
+int unset_alias(shell_t *, char *);
+int set_alias(shell_t *, char *);
+int print_alias(alias_t *);
+void alias_free(alias_t *);
+
 /**
  * alias_builtin - implements the functionality of the alias command.
  *		It allows the user to define or list aliases for commands.
+ *		A value of several words is quoted: alias ll='ls -l'.
  * @data: A pointer to the shell data structure
  *		which contains information about the current state of the shell.
- *  Return: returns 0 to indicate successful completion.
+ *  Return: returns 0 to indicate successful completion, 1 if memory ran out.
  */
 int alias_builtin(shell_t *data)
 {
-	int i = 0;
-	char *position = NULL;
-	list_t *node = NULL;
+	int i = 0, status = 0;
+	char *arg;
 
 	if (data->argc == 1)
+		return (alias_list(data));
+	for (i = 1; (arg = data->argv[i]); i++)
 	{
-		node = data->alias;
-		while (node)
+		if (_strchr(arg, '='))
 		{
-			print_alias(node);
-			node = node->next;
+			arg = alias_quoted(data, &i);
+			status |= !arg || set_alias(data, arg) == -1;
 		}
-		return (0);
-	}
-	for (i = 1; data->argv[i]; i++)
-	{
-		position = _strchr(data->argv[i], '=');
-		if (position)
-			set_alias(data, data->argv[i]);
 		else
-			print_alias(node_prefix(data->alias, data->argv[i], '='));
+			print_alias(alias_get(data, arg, _strlen(arg)));
 	}
 
-	return (0);
+	return (status);
 }
 
 /**
- * unset_alias - responsible for removing an alias from the alias list.
+ * unset_alias - responsible for removing an alias from the alias table.
  *		It resembles the unset command in a shell.
+ * The alias is freed once the command ends, as its words may be
+ *		the command's own.
  * @data: A pointer to the shell data structure,
 *		which contains information about the current state of the shell.
- * @string: the alias to be unset.
- * Return: returns the value returned by remove_index(),
- *		which indicates the success or failure of the removal operation.
+ * @string: the alias to be unset, as name=.
+ * Return: returns 0 if the alias was removed, 1 if there was none.
  */
 int unset_alias(shell_t *data, char *string)
 {
-	char *point, store;
-	int ret;
+	char *point = _strchr(string, '=');
+	alias_t *a, **link;
 
-	point = _strchr(string, '=');
-	/* to find the equals sign (=) in the string*/
 	if (!point)
 		return (1);
-	store = *point;
-	*point = 0;
-	ret = remove_index(&(data->alias),
-		 find_index(data->alias,
-		node_prefix(data->alias, string, -1)));
-	*point = store;
-	return (ret);
+	a = alias_get(data, string, point - string);
+	if (!a)
+		return (1);
+	link = &data->alias->buckets[a->hash % ALIAS_HASH_SIZE];
+	while (*link != a)
+		link = &(*link)->next;
+	*link = a->next;
+	data->alias->count--;
+	a->next = data->alias->retired;
+	data->alias->retired = a;
+	return (0);
 }
 
 /**
  * set_alias - sets an alias for a command.
  *		It takes a string in the format alias_name=command
- *		and adds it to the alias list in the shell data structure.
+ *		and adds it to the alias table in the shell data structure,
+ *		with its value split into words once and for all.
+ * An alias with an empty value is unset, and one that is redefined is
+ *		listed after the others, as if it was new.
  * @data: A pointer to the shell data structure,
  *		which contains information about the current state of the shell.
  * @string: the alias to be set.
- * Return: returns the result of calling the append_node() function
- *		to add the new alias to the alias list.
- *		Finally, the function returns 0 to indicate successful completion.
+ * Return: returns 0 to indicate successful completion, 1 for a string
+ *		without '=', -1 if memory ran out.
  */
 int set_alias(shell_t *data, char *string)
 {
-	char *point;
+	char *point = _strchr(string, '=');
+	alias_t *a;
+	size_t len;
 
-	point = _strchr(string, '=');
 	if (!point)
 		return (1);
 	if (!*++point)
-		return (unset_alias(data, string));
-
-	unset_alias(data, string);
-	return (append_node(&(data->alias), string, 0) == NULL);
+		return (unset_alias(data, string), 0);
+	if (!data->alias)
+		data->alias = calloc(1, sizeof(aliastab_t));
+	a = data->alias ? calloc(1, sizeof(alias_t)) : NULL;
+	if (!a)
+		return (-1);
+	a->text = _strdup(string);
+	a->body = _strdup(point);
+	if (!a->text || !a->body ||
+			tokenize(a->body, blank_delims, &a->words) == -1)
+		return (alias_free(a), -1);
+	len = _strlen(point);
+	a->blank = IS_DELIM(blank_delims, point[len - 1]);
+	a->nlen = point - 1 - string;
+	a->hash = env_hash(string, a->nlen);
+	a->seq = ++data->alias->seq;
+	unset_alias(data, string); /* string may be a word of the old one */
+	a->next = data->alias->buckets[a->hash % ALIAS_HASH_SIZE];
+	data->alias->buckets[a->hash % ALIAS_HASH_SIZE] = a;
+	data->alias->count++;
+	return (0);
 }
 
 /**
  * print_alias - prints the name and value of an alias.
- * @node: A pointer to a linked list node that represents an alias.
- * The node contains a string in the format alias_name=alias_value.
+ * @a: the alias, may be NULL.
  * Return: returns 0 if it successfully prints the alias
- *		or returns 1 if the input node parameter is NULL.
+ *		or returns 1 if the input alias parameter is NULL.
  */
-int print_alias(list_t *node)
+int print_alias(alias_t *a)
 {
-	char *point = NULL, *index = NULL;
+	size_t i;
 
-	if (node)
+	if (a)
 	{
-		point = _strchr(node->string, '=');
-		for (index = node->string; index <= point; index++)
-			_putchar(*index);
+		for (i = 0; i <= a->nlen; i++)
+			_putchar(a->text[i]);
 		_putchar('\'');
-		_puts(point + 1);
+		_puts(a->text + a->nlen + 1);
 		_puts("'\n");
 		return (0);
 	}
@@ -112,32 +133,13 @@ int print_alias(list_t *node)
 }
 
 /**
- * replace_alias - replaces the command name in the data->argv[0] argument
- * with the corresponding alias value, if an alias exists for that command.
- * @data: A pointer to the shell data structure
- *	which contains information about the current state of the shell.
- * Return: returns 1 to indicate that the alias replacement was successful.
+ * alias_free - frees an alias.
+ * @a: the alias.
  */
-int replace_alias(shell_t *data)
+void alias_free(alias_t *a)
 {
-	int index;
-	list_t *node;
-	char *point;
-
-	for (index = 0; index < 10; index++)
-	{
-		node = node_prefix(data->alias, data->argv[0], '=');
-		if (!node)
-			return (0);
-		free(data->argv[0]);
-		point = _strchr(node->string, '=');
-		if (!point)
-			return (0);
-		point = _strdup(point + 1);
-		if (!point)
-			return (0);
-		data->argv[0] = point;
-	}
-	return (1);
+	free(a->text);
+	free(a->body);
+	strvec_free(&a->words);
+	free(a);
 }
-
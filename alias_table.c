@@ -0,0 +1,148 @@
+#include "shell.h"
+
+alias_t *alias_get(shell_t *, char *, size_t);
+int alias_list(shell_t *);
+void free_aliases(shell_t *);
+void free_retired(shell_t *);
+char *alias_quoted(shell_t *, int *);
+
+/**
+ * alias_get - finds an alias by name in the alias table.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * @name: the name, not necessarily terminated after it.
+ * @nlen: the length of the name.
+ * Return: the alias, or NULL if there is none.
+ */
+alias_t *alias_get(shell_t *data, char *name, size_t nlen)
+{
+	unsigned long hash;
+	alias_t *a;
+
+	if (!data->alias || !data->alias->count)
+		return (NULL);
+	hash = env_hash(name, nlen);
+	for (a = data->alias->buckets[hash % ALIAS_HASH_SIZE]; a; a = a->next)
+		if (a->hash == hash && a->nlen == nlen &&
+				!memcmp(a->text, name, nlen))
+			return (a);
+	return (NULL);
+}
+
+/**
+ * alias_list - prints every alias, in the order they were defined.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * Return: 0, or 1 if memory ran out.
+ */
+int alias_list(shell_t *data)
+{
+	alias_t **all, *a;
+	size_t i, j, n = 0;
+
+	if (!data->alias || !data->alias->count)
+		return (0);
+	all = malloc(sizeof(alias_t *) * data->alias->count);
+	if (!all)
+		return (1);
+	for (i = 0; i < ALIAS_HASH_SIZE; i++)
+		for (a = data->alias->buckets[i]; a; a = a->next)
+		{
+			for (j = n++; j && all[j - 1]->seq > a->seq; j--)
+				all[j] = all[j - 1];
+			all[j] = a;
+		}
+	for (i = 0; i < n; i++)
+		print_alias(all[i]);
+	free(all);
+	return (0);
+}
+
+/**
+ * free_aliases - frees the alias table.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ */
+void free_aliases(shell_t *data)
+{
+	alias_t *a, *next;
+	int i;
+
+	if (!data->alias)
+		return;
+	for (i = 0; i < ALIAS_HASH_SIZE; i++)
+		for (a = data->alias->buckets[i]; a; a = next)
+		{
+			next = a->next;
+			alias_free(a);
+		}
+	free_retired(data);
+	free(data->alias);
+	data->alias = NULL;
+}
+
+/**
+ * free_retired - frees the aliases the command just run removed or
+ *		redefined, once none of its words can be theirs.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ */
+void free_retired(shell_t *data)
+{
+	alias_t *a;
+
+	while (data->alias && (a = data->alias->retired))
+	{
+		data->alias->retired = a->next;
+		alias_free(a);
+	}
+}
+
+/**
+ * alias_quoted - joins the value of a definition quoted as in
+ *		alias ll='ls -l', which the command line splits into
+ *		ll='ls and -l', back into one, without its quotes.
+ * The words are joined by single blanks, as the command line keeps no
+ *		more than that; a value whose quote is not closed is taken
+ *		as it is.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * @i: the index of the definition in argv, moved to its last word.
+ * Return: the definition, on the arena if it was quoted, or NULL if
+ *		memory ran out.
+ */
+char *alias_quoted(shell_t *data, int *i)
+{
+	char *arg = data->argv[*i], *eq = _strchr(arg, '='), *def, *w;
+	size_t len, n = 0;
+	int j, k;
+
+	if (eq[1] != '\'' && eq[1] != '"')
+		return (arg);
+	for (j = *i; data->argv[j]; j++)
+	{
+		w = j == *i ? eq + 2 : data->argv[j];
+		len = _strlen(w);
+		n += _strlen(data->argv[j]) + 1;
+		if (len && w[len - 1] == eq[1])
+			break;
+	}
+	if (!data->argv[j])
+		return (arg);
+	def = arena_alloc(&data->arena, n);
+	if (!def)
+		return (NULL);
+	len = eq + 1 - arg;
+	memcpy(def, arg, len);
+	for (k = *i; k <= j; k++)
+	{
+		w = k == *i ? eq + 2 : data->argv[k];
+		if (k != *i)
+			def[len++] = ' ';
+		memcpy(def + len, w, _strlen(w));
+		len += _strlen(w);
+	}
+	def[len - 1] = '\0'; /* the closing quote */
+	*i = j;
+	return (def);
+}
@@ -0,0 +1,126 @@
+#include "shell.h"
+
+void *arena_alloc(arena_t *, size_t);
+char *arena_strndup(arena_t *, const char *, size_t);
+void arena_adopt(arena_t *, arena_t *);
+void arena_reset(arena_t *);
+void arena_free(arena_t *);
+
+/**
+ * arena_alloc - hands out memory from an arena, which is only given back
+ *		when the arena is reset.
+ * A request larger than a quarter of a chunk gets a chunk of its own,
+ *		behind the one being handed out, which goes on being used.
+ * @a: the arena.
+ * @n: the number of bytes.
+ * Return: the memory, aligned for any pointer or integer, or NULL if
+ *		memory ran out.
+ */
+void *arena_alloc(arena_t *a, size_t n)
+{
+	arena_chunk_t *c = a->head;
+	size_t size;
+
+	n = (n + ARENA_ALIGN - 1) & ~(ARENA_ALIGN - 1);
+	if (!c || c->size - c->used < n)
+	{
+		size = n > ARENA_CHUNK_SIZE / 4 ? n : ARENA_CHUNK_SIZE;
+		c = malloc(sizeof(arena_chunk_t) + size);
+		if (!c)
+			return (NULL);
+		c->size = size;
+		c->used = 0;
+		if (a->head && size != ARENA_CHUNK_SIZE)
+		{
+			c->next = a->head->next;
+			a->head->next = c;
+		}
+		else
+		{
+			c->next = a->head;
+			a->head = c;
+		}
+	}
+	c->used += n;
+	return ((char *)(c + 1) + c->used - n);
+}
+
+/**
+ * arena_strndup - copies the first bytes of a string into an arena.
+ * @a: the arena.
+ * @s: the string.
+ * @n: the number of bytes to copy.
+ * Return: the copy, terminated, or NULL if memory ran out.
+ */
+char *arena_strndup(arena_t *a, const char *s, size_t n)
+{
+	char *copy = arena_alloc(a, n + 1);
+
+	if (!copy)
+		return (NULL);
+	memcpy(copy, s, n);
+	copy[n] = '\0';
+	return (copy);
+}
+
+/**
+ * arena_adopt - moves the chunks of an arena into another one, which
+ *		gives them back when it is reset.
+ * @to: the arena taking the chunks.
+ * @from: the arena giving them, left empty.
+ */
+void arena_adopt(arena_t *to, arena_t *from)
+{
+	arena_chunk_t *last = from->head;
+
+	if (!last)
+		return;
+	while (last->next)
+		last = last->next;
+	if (to->head)
+	{
+		last->next = to->head->next;
+		to->head->next = from->head;
+	}
+	else
+		to->head = from->head;
+	from->head = NULL;
+}
+
+/**
+ * arena_reset - gives back everything handed out by an arena at once.
+ * One chunk of the usual size is kept for what comes next, so that in
+ *		the common case this only rewinds it; the chunks that a larger
+ *		command needed are freed.
+ * @a: the arena.
+ */
+void arena_reset(arena_t *a)
+{
+	arena_chunk_t *c, *next, *keep = NULL;
+
+	for (c = a->head; c; c = next)
+	{
+		next = c->next;
+		if (!keep && c->size == ARENA_CHUNK_SIZE)
+			keep = c;
+		else
+			free(c);
+	}
+	if (keep)
+	{
+		keep->next = NULL;
+		keep->used = 0;
+	}
+	a->head = keep;
+}
+
+/**
+ * arena_free - frees every chunk of an arena.
+ * @a: the arena.
+ */
+void arena_free(arena_t *a)
+{
+	arena_reset(a);
+	free(a->head);
+	a->head = NULL;
+}
@@ -0,0 +1,38 @@
+#!/bin/sh
+#
+# Times a gen | filter | sink pipeline under each shell given, default
+# ./hsh and dash: once moving 1 GiB through tr, once as 1000 pipelines
+# of a line each, where starting the stages is all the work. Run from
+# the top directory, after building the shell:
+#
+#	sh bench/pipe_bench.sh [SHELL...]
+#
+# HSH_PIPESZ is passed through, to time larger pipes.
+
+[ $# -gt 0 ] || set -- ./hsh dash
+dir=$(mktemp -d) || exit 1
+trap 'rm -rf "$dir"' EXIT
+printf '%s\n' 'head -c 1073741824 /dev/zero | tr "\0" a | wc -c' >"$dir/big"
+i=0
+while [ $i -lt 1000 ]; do
+	echo 'echo x | tr x y | wc -c'
+	i=$((i + 1))
+done >"$dir/small"
+
+# ms SHELL SCRIPT: the best of three runs of SCRIPT, in milliseconds
+ms() {
+	best=
+	for run in 1 2 3; do
+		t0=$(date +%s%N)
+		"$1" "$2" >/dev/null || return 1
+		t=$((($(date +%s%N) - t0) / 1000000))
+		[ -n "$best" ] && [ "$best" -le $t ] || best=$t
+	done
+	echo $best
+}
+
+printf '%-20s %10s %14s\n' shell '1 GiB ms' '1000 pipes ms'
+for sh in "$@"; do
+	printf '%-20s %10s %14s\n' "$sh" "$(ms "$sh" "$dir/big")" \
+		"$(ms "$sh" "$dir/small")"
+done
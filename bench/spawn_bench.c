@@ -0,0 +1,90 @@
+#include "shell.h"
+#undef main
+
+/*
+ * Times the spawn backends of the shell as its heap grows: fork(),
+ * vfork(), posix_spawn() and the zygote, started while the process is
+ * still small, as the shell does. Each spawn runs /bin/true and is waited
+ * for. Built with the shell's sources, its main() renamed, from the top
+ * directory:
+ *
+ *	gcc -O2 -std=gnu89 -I. -Dmain=hsh_main bench/spawn_bench.c *.c \
+ *		-o spawn_bench
+ */
+
+double spawn_time(shell_t *, int, int);
+
+/**
+ * spawn_time - times spawns of data->path with one backend, each waited
+ *		for before the next.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * @backend: one of the SPAWN_* values.
+ * @n: the number of spawns.
+ * Return: the time of one spawn and wait, in microseconds.
+ */
+double spawn_time(shell_t *data, int backend, int n)
+{
+	struct timespec t0, t1;
+	int i, err;
+	pid_t pid;
+
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+	for (i = 0; i < n; i++)
+	{
+		if (backend == SPAWN_FORK)
+			pid = spawn_fork(data, environ, NULL, &err);
+		else if (backend == SPAWN_VFORK)
+			pid = spawn_vfork(data, environ, NULL, &err);
+		else if (backend == SPAWN_ZYGOTE)
+			pid = spawn_zygote(data, environ, NULL, &err);
+		else
+			pid = spawn_posix(data, environ, NULL, &err);
+		if (pid > 0)
+			waitpid(pid, NULL, 0);
+	}
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	return (((t1.tv_sec - t0.tv_sec) * 1e6 +
+				(t1.tv_nsec - t0.tv_nsec) / 1e3) / n);
+}
+
+/**
+ * main - grows the heap to 0, 64, 256 and 1024 MiB, touching every page,
+ *		and prints the time of a spawn with each backend at each size.
+ * Return: 0, or 1 if memory ran out.
+ */
+int main(void)
+{
+	static int backends[] = {SPAWN_FORK, SPAWN_VFORK, SPAWN_POSIX,
+		SPAWN_ZYGOTE};
+	static size_t sizes[] = {0, 64, 256, 1024};
+	shell_t data[] = {SHELL_INIT};
+	char *argv[] = {"true", NULL}, *heap;
+	struct rusage ru;
+	size_t have = 0;
+	int i, b;
+
+	data->path = "/bin/true";
+	data->argv = argv;
+	data->fname = "spawn_bench";
+	zygote_start(data);
+	printf("heap MiB  rss MiB      fork     vfork     posix    zygote\n");
+	for (i = 0; i < 4; i++)
+	{
+		if (sizes[i] > have)
+		{
+			heap = malloc((sizes[i] - have) << 20);
+			if (!heap)
+				return (1);
+			memset(heap, 1, (sizes[i] - have) << 20); /* kept */
+			have = sizes[i];
+		}
+		getrusage(RUSAGE_SELF, &ru);
+		printf("%8lu %8ld", (unsigned long)have, ru.ru_maxrss / 1024);
+		for (b = 0; b < 4; b++)
+			printf(" %9.1f", spawn_time(data, backends[b], 500));
+		printf("\n");
+	}
+	zygote_stop(data);
+	return (0);
+}
@@ -0,0 +1,132 @@
+#include "shell.h"
+
+/*
+ * Times the string scanners on short, medium and long strings: the byte
+ * at a time loops the shell used to have, the word at a time ones, and
+ * those using SSE2 and AVX2. Built apart from the shell, from the top
+ * directory, without letting gcc turn the byte loops into libc calls:
+ *
+ *	gcc -O2 -std=gnu89 -fno-tree-loop-distribute-patterns -I. \
+ *		bench/str_bench.c str_word.c str_sse2.c str_avx2.c \
+ *		-o str_bench
+ */
+
+size_t str_len_byte(const char *);
+const char *str_chr_byte(const char *, int);
+size_t str_cmp_byte(const char *, const char *);
+double str_bench(strops_t *, int, const char *, const char *);
+
+static char bench_a[8192 + 64], bench_b[8192 + 64];
+static volatile size_t bench_sink;
+
+/**
+ * str_len_byte - returns the length of a string, a byte at a time.
+ * @s: the string.
+ * Return: its length.
+ */
+size_t str_len_byte(const char *s)
+{
+	size_t n = 0;
+
+	while (s[n])
+		n++;
+	return (n);
+}
+
+/**
+ * str_chr_byte - looks for a character in a string, a byte at a time.
+ * @s: the string.
+ * @c: the character.
+ * Return: its first occurrence, or else the string's terminating '\0'.
+ */
+const char *str_chr_byte(const char *s, int c)
+{
+	while (*s && *s != (char)c)
+		s++;
+	return (s);
+}
+
+/**
+ * str_cmp_byte - looks for the first difference between two strings,
+ *		a byte at a time.
+ * @a: the first string.
+ * @b: the second string.
+ * Return: the index at which they differ, or both end.
+ */
+size_t str_cmp_byte(const char *a, const char *b)
+{
+	size_t i = 0;
+
+	while (a[i] && a[i] == b[i])
+		i++;
+	return (i);
+}
+
+/**
+ * str_bench - times one scanner on two equal strings, for about a
+ *		tenth of a second.
+ * @ops: the scanners.
+ * @op: 0 for the length, 1 for a character that is not there, 2 to
+ *		compare the strings.
+ * @a: the first string.
+ * @b: the second string.
+ * Return: the time of one call, in nanoseconds.
+ */
+double str_bench(strops_t *ops, int op, const char *a, const char *b)
+{
+	struct timespec t0, t1;
+	long i, n = 1000;
+	double ns;
+
+	while (1)
+	{
+		clock_gettime(CLOCK_MONOTONIC, &t0);
+		for (i = 0; i < n; i++)
+			bench_sink += op == 0 ? ops->len(a) : op == 1 ?
+				(size_t)ops->chr(a, '#') : ops->cmp(a, b);
+		clock_gettime(CLOCK_MONOTONIC, &t1);
+		ns = (t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec);
+		if (ns > 1e8)
+			return (ns / n);
+		n *= 2;
+	}
+}
+
+/**
+ * main - prints the time of a call of each scanner, in nanoseconds, on
+ *		strings of 8, 64, 512 and 4096 bytes that start one byte past
+ *		an aligned address.
+ * Return: 0.
+ */
+int main(void)
+{
+	static char *names[] = {"len", "chr", "cmp"};
+	static size_t sizes[] = {8, 64, 512, 4096};
+	strops_t ops[4] = {{str_len_byte, str_chr_byte, str_cmp_byte},
+		{str_len_word, str_chr_word, str_cmp_word},
+		{str_len_sse2, str_chr_sse2, str_cmp_sse2},
+		{str_len_avx2, str_chr_avx2, str_cmp_avx2}};
+	char *a = bench_a + 64 - (size_t)bench_a % 64 + 1;
+	char *b = bench_b + 64 - (size_t)bench_b % 64 + 1;
+	int avx2, i, op, impl;
+
+	__builtin_cpu_init();
+	avx2 = __builtin_cpu_supports("avx2");
+	printf("bytes  op       byte      word      sse2      avx2\n");
+	for (i = 0; i < 4; i++)
+		for (op = 0; op < 3; op++)
+		{
+			memset(a, 'x', sizes[i]);
+			memset(b, 'x', sizes[i]);
+			a[sizes[i]] = b[sizes[i]] = '\0';
+			printf("%5lu  %s", (unsigned long)sizes[i], names[op]);
+			for (impl = 0; impl < 4; impl++)
+				if (impl == 3 && !avx2)
+					printf("         -");
+				else
+					printf(" %9.1f", str_bench(&ops[impl],
+								op, a, b));
+			printf("\n");
+		}
+	return (0);
+}
@@ -0,0 +1,163 @@
+#include "shell.h"
+#undef main
+
+/*
+ * Times the string copies on short, medium and long strings: the byte at
+ * a time loops the shell used to have, then the shell's _strcat(),
+ * _strdup() and _strncpy() with the word at a time, SSE2 and AVX2
+ * scanners in turn. _strncpy() uses memchr() rather than a scanner, so
+ * its last three columns only differ by noise. Built with the shell's
+ * sources, its main() renamed, from the top directory, without letting
+ * gcc turn the byte loops into libc calls:
+ *
+ *	gcc -O2 -std=gnu89 -fno-tree-loop-distribute-patterns -I. \
+ *		-Dmain=hsh_main bench/str_copy_bench.c *.c \
+ *		-o str_copy_bench -lpthread
+ */
+
+char *str_cat_byte(char *, char *);
+char *str_dup_byte(const char *);
+char *str_ncpy_byte(char *, char *, int);
+double copy_bench(int, int, char *, size_t);
+
+static char bench_src[8192 + 64], bench_dst[8192 + 64];
+
+/**
+ * str_cat_byte - appends a string to another, a byte at a time.
+ * @dest: the string appended to.
+ * @src: the string appended.
+ * Return: dest.
+ */
+char *str_cat_byte(char *dest, char *src)
+{
+	char *ret = dest;
+
+	while (*dest)
+		dest++;
+	while (*src)
+		*dest++ = *src++;
+	*dest = *src;
+	return (ret);
+}
+
+/**
+ * str_dup_byte - copies a string into new memory, measuring it a byte at
+ *		a time, then copying it a byte at a time.
+ * @s: the string.
+ * Return: the copy, or NULL if memory ran out.
+ */
+char *str_dup_byte(const char *s)
+{
+	size_t n = 0, i;
+	char *d;
+
+	while (s[n])
+		n++;
+	d = malloc(n + 1);
+	for (i = 0; d && i <= n; i++)
+		d[i] = s[i];
+	return (d);
+}
+
+/**
+ * str_ncpy_byte - copies at most n - 1 bytes of a string and pads the
+ *		rest of the n bytes with NULs, a byte at a time.
+ * @dest: the copy.
+ * @src: the string.
+ * @n: the size of the copy.
+ * Return: dest.
+ */
+char *str_ncpy_byte(char *dest, char *src, int n)
+{
+	int i = 0;
+
+	for (; src[i] && i < n - 1; i++)
+		dest[i] = src[i];
+	for (; i < n; i++)
+		dest[i] = '\0';
+	return (dest);
+}
+
+/**
+ * copy_bench - times one copy of a string, for about a tenth of a second.
+ * @op: 0 to append it to a one byte string, 1 to duplicate it, 2 to copy
+ *		it with _strncpy() and a size one past its length.
+ * @byte: non-zero for the byte at a time loop, 0 for the shell's function.
+ * @s: the string.
+ * @len: its length.
+ * Return: the time of one call, in nanoseconds.
+ */
+double copy_bench(int op, int byte, char *s, size_t len)
+{
+	struct timespec t0, t1;
+	long i, n = 1000;
+	double ns;
+
+	while (1)
+	{
+		clock_gettime(CLOCK_MONOTONIC, &t0);
+		for (i = 0; i < n; i++)
+			if (op == 0)
+			{
+				bench_dst[0] = 'y';
+				bench_dst[1] = '\0';
+				if (byte)
+					str_cat_byte(bench_dst, s);
+				else
+					_strcat(bench_dst, s);
+			}
+			else if (op == 1)
+				free(byte ? str_dup_byte(s) : _strdup(s));
+			else if (byte)
+				str_ncpy_byte(bench_dst, s, len + 1);
+			else
+				_strncpy(bench_dst, s, len + 1);
+		clock_gettime(CLOCK_MONOTONIC, &t1);
+		ns = (t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec);
+		if (ns > 1e8)
+			return (ns / n);
+		n *= 2;
+	}
+}
+
+/**
+ * main - prints the time of a call of each copy, in nanoseconds, on
+ *		strings of 8, 64, 512 and 4096 bytes that start one byte past
+ *		an aligned address.
+ * Return: 0.
+ */
+int main(void)
+{
+	static char *names[] = {"cat", "dup", "ncpy"};
+	static size_t sizes[] = {8, 64, 512, 4096};
+	strops_t ops[3] = {{str_len_word, str_chr_word, str_cmp_word},
+		{str_len_sse2, str_chr_sse2, str_cmp_sse2},
+		{str_len_avx2, str_chr_avx2, str_cmp_avx2}};
+	char *s = bench_src + 64 - (size_t)bench_src % 64 + 1;
+	int avx2, i, op, impl;
+	size_t len;
+
+	__builtin_cpu_init();
+	avx2 = __builtin_cpu_supports("avx2");
+	printf("bytes  op        byte      word      sse2      avx2\n");
+	for (i = 0; i < 4; i++)
+		for (op = 0; op < 3; op++)
+		{
+			len = sizes[i];
+			memset(s, 'x', len);
+			s[len] = '\0';
+			printf("%5lu  %-4s", (unsigned long)len, names[op]);
+			printf(" %9.1f", copy_bench(op, 1, s, len));
+			for (impl = 0; impl < 3; impl++)
+			{
+				str_ops = ops[impl];
+				if (impl == 2 && !avx2)
+					printf("         -");
+				else
+					printf(" %9.1f",
+						copy_bench(op, 0, s, len));
+			}
+			printf("\n");
+		}
+	return (0);
+}
@@ -0,0 +1,121 @@
+#include "shell.h"
+#undef main
+
+/*
+ * Times the walk behind ** with several numbers of threads, over a tree
+ * of 1111 directories holding 100 files each, made under the directory
+ * given the first time. Built with the shell's sources, its main()
+ * renamed, from the top directory:
+ *
+ *	gcc -O2 -std=gnu89 -I. -Dmain=hsh_main bench/walk_bench.c *.c \
+ *		-o walk_bench -lpthread
+ *
+ *	walk_bench DIR [THREADS...]
+ *
+ * The first walk of each number of threads reads a cold tree if the page
+ * cache was dropped before, as root: sync; echo 3 >/proc/sys/vm/drop_caches
+ */
+
+int tree_make(strbuf_t *, int);
+double walk_time(shell_t *, strbuf_t *, size_t *);
+
+/**
+ * tree_make - makes a directory of 100 files and, above the last level,
+ *		10 directories made the same way.
+ * @path: the directory, terminated, which is left as it was.
+ * @depth: the number of levels of directories under it.
+ * Return: 0 on success, -1 on failure.
+ */
+int tree_make(strbuf_t *path, int depth)
+{
+	size_t len = path->len;
+	char name[16];
+	int i, fd;
+
+	if (mkdir(path->s, 0755) == -1)
+		return (-1);
+	for (i = 0; i < 100 + (depth ? 10 : 0); i++)
+	{
+		sprintf(name, i < 100 ? "/f%d.c" : "/d%d", i);
+		path->len = len;
+		if (strbuf_add(path, name, _strlen(name) + 1) == -1)
+			return (-1);
+		path->len--;
+		if (i >= 100 && tree_make(path, depth - 1) == -1)
+			return (-1);
+		fd = i < 100 ? open(path->s, O_CREAT | O_WRONLY, 0644) : -2;
+		if (fd == -1)
+			return (-1);
+		if (fd >= 0)
+			close(fd);
+	}
+	path->len = len;
+	path->s[len] = '\0';
+	return (0);
+}
+
+/**
+ * walk_time - walks the tree for the names matching *1*, as the last
+ *		component of a ** pattern.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * @path: the tree, with its trailing '/'.
+ * @n: receives the number of names found.
+ * Return: the time of the walk, in milliseconds.
+ */
+double walk_time(shell_t *data, strbuf_t *path, size_t *n)
+{
+	strvec_t found = {NULL, 0, 0};
+	struct timespec t0, t1;
+
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+	walk_tree(data, path, "*1*", &found);
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	*n = found.len;
+	strvec_free(&found);
+	free_data(data, 0);
+	return ((t1.tv_sec - t0.tv_sec) * 1e3 +
+			(t1.tv_nsec - t0.tv_nsec) / 1e6);
+}
+
+/**
+ * main - makes the tree if it is not there, then prints, for each
+ *		number of threads, the time of a first walk and the best of
+ *		five more.
+ * @argc: the number of arguments.
+ * @argv: the tree, then the numbers of threads, 1 2 4 8 by default.
+ * Return: 0, or 1 on failure.
+ */
+int main(int argc, char **argv)
+{
+	static char *counts[] = {"1", "2", "4", "8", NULL};
+	shell_t data[] = {SHELL_INIT};
+	strbuf_t path = {NULL, 0, 0};
+	char **threads = argc > 2 ? argv + 2 : counts;
+	double first, best, t;
+	size_t n;
+	int i;
+
+	if (argc < 2 || strbuf_add(&path, argv[1], _strlen(argv[1]) + 1))
+		return (1);
+	path.len--;
+	if (access(path.s, F_OK) && tree_make(&path, 3) == -1)
+		return (perror(argv[1]), 1);
+	if (strbuf_add(&path, "/", 2) == -1)
+		return (1);
+	path.len--;
+	printf("threads   first ms    best ms    found\n");
+	for (; *threads; threads++)
+	{
+		_setenv(data, "HSH_GLOB_THREADS", *threads);
+		first = best = walk_time(data, &path, &n);
+		for (i = 0; i < 5; i++)
+			if ((t = walk_time(data, &path, &n)) < best)
+				best = t;
+		printf("%7s %10.1f %10.1f %8lu\n", *threads, first, best,
+				(unsigned long)n);
+	}
+	free_data(data, 1);
+	free(path.s);
+	return (0);
+}
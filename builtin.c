@@ -28,7 +28,7 @@ int exit_builtin(shell_t *data)
 			/* prints an error message */
 			_eputs(data->argv[1]);
 			_puts2('\n');
-			return (1);
+			return (2);
 		}
 		data->estatus = _atoi(data->argv[1]);
 		return (-2);
@@ -85,9 +85,11 @@ int cd_builtin(shell_t *data)
 		_perror(data, "can't cd to ");
 		_eputs(data->argv[1]);
 		_puts2('\n');
+		return (2);
 	}
 	else
 	{
+		stat_cache_flush(data); /* relative paths point elsewhere */
 		_setenv(data, "OLDPWD", _getenv(data, "PWD="));
 		_setenv(data, "PWD", getcwd(buffer, 1024));
 	}
@@ -103,13 +105,14 @@ int cd_builtin(shell_t *data)
  */
 int env_builtin(shell_t *data)
 {
-	list_t *env = data->env;
+	size_t i;
 
-	while (env)
-	{
-		printf("%s\n", env->string);
-		env = env->next;
-	}
+	for (i = 0; i < data->env.len; i++)
+		if (data->env.envp[i])
+		{
+			_puts(data->env.envp[i]);
+			_putchar('\n');
+		}
 
 	return (0);
 }
@@ -129,7 +132,7 @@ int setenv_builtin(shell_t *data)
 		return (1);
 	}
 
-	if (setenv(data->argv[1], data->argv[2], 1) != 0)
+	if (_setenv(data, data->argv[1], data->argv[2]) != 0)
 	{
 		_perror(data, "setenv");
 		return (1);
@@ -156,13 +159,7 @@ int unsetenv_builtin(shell_t *data)
 	}
 
 	for (i = 1; i < data->argc; i++)
-	{
-		if (unsetenv(data->argv[i]) != 0)
-		{
-			_perror(data, "unsetenv");
-			return (1);
-		}
-	}
+		_unsetenv(data, data->argv[i]);
 
 	return (0);
 }
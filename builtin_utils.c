@@ -0,0 +1,121 @@
+#include "shell.h"
+
+int echo_builtin(shell_t *);
+int pwd_builtin(shell_t *);
+int true_builtin(shell_t *);
+int false_builtin(shell_t *);
+int time_builtin(shell_t *);
+
+/**
+ * echo_builtin - implements the functionality of the echo command,
+ *		like the echo utility it replaces: the arguments are printed
+ *		separated by spaces and followed by a newline.
+ *	-n	no newline at the end
+ *	-e	backslash escapes are interpreted, \c ends the output
+ *	-E	backslash escapes are printed as they are, the default
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * Return: 0.
+ */
+int echo_builtin(shell_t *data)
+{
+	int i = 1, j, newline = 1, escapes = 0, stop = 0;
+	char *arg;
+
+	for (; (arg = data->argv[i]) && arg[0] == '-' && arg[1]; i++)
+	{
+		for (j = 1; arg[j] && _strchr("neE", arg[j]); j++)
+			;
+		if (arg[j]) /* not an option after all */
+			break;
+		for (j = 1; arg[j]; j++)
+			if (arg[j] == 'n')
+				newline = 0;
+			else
+				escapes = arg[j] == 'e';
+	}
+	for (; data->argv[i] && !stop; i++)
+	{
+		for (arg = data->argv[i]; *arg && !stop; arg++)
+			if (escapes && *arg == '\\' && arg[1])
+				arg += put_escape(arg + 1, 1, &stop);
+			else
+				_putchar(*arg);
+		if (data->argv[i + 1] && !stop)
+			_putchar(' ');
+	}
+	if (newline && !stop)
+		_putchar('\n');
+	return (0);
+}
+
+/**
+ * pwd_builtin - implements the functionality of the pwd command.
+ *		It prints PWD when it still names the current directory,
+ *		the physical path otherwise or with -P.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * Return: 0 on success, 1 if the current directory is unknown.
+ */
+int pwd_builtin(shell_t *data)
+{
+	char *pwd = _getenv(data, "PWD="), buffer[PATH_MAX];
+	struct stat logical, physical;
+
+	if (data->argv[1] && !_strcmp(data->argv[1], "-P"))
+		pwd = NULL;
+	if (!pwd || pwd[0] != '/' || stat(pwd, &logical) ||
+			stat(".", &physical) ||
+			logical.st_ino != physical.st_ino ||
+			logical.st_dev != physical.st_dev)
+		pwd = getcwd(buffer, sizeof(buffer));
+	if (!pwd)
+	{
+		_perror(data, "");
+		_eputs(strerror(errno));
+		_eputs("\n");
+		return (1);
+	}
+	_puts(pwd);
+	_putchar('\n');
+	return (0);
+}
+
+/**
+ * true_builtin - implements the true and : commands, which do nothing.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * Return: 0.
+ */
+int true_builtin(__attribute__((unused)) shell_t *data)
+{
+	return (0);
+}
+
+/**
+ * false_builtin - implements the false command, which only fails.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * Return: 1.
+ */
+int false_builtin(__attribute__((unused)) shell_t *data)
+{
+	return (1);
+}
+
+/**
+ * time_builtin - implements a time keyword with no command after it,
+ *		which reports the cost of nothing.
+ * A command after time is timed by the instruction loop instead.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * Return: 0.
+ */
+int time_builtin(__attribute__((unused)) shell_t *data)
+{
+	usage_t u;
+
+	memset(&u, 0, sizeof(u));
+	time_report(&u);
+	return (0);
+}
@@ -0,0 +1,202 @@
+#include "shell.h"
+
+char *hash_lookup(shell_t *, char *, char *);
+int hash_set_path(cmdtable_t *, char *);
+int hash_dirs_changed(cmdtable_t *);
+cmdhash_t *hash_search(shell_t *, cmdtable_t *, char *, cmdhash_t *);
+void hash_flush(cmdtable_t *, int);
+
+/**
+ * hash_lookup - finds a command in PATH through the command hash table.
+ * A command found in an absolute directory is trusted as long as PATH
+ *		is unchanged and none of its directories has been modified.
+ *		One found in a relative directory depends on the current
+ *		directory, and a missing one may have been installed since,
+ *		so both are searched for again, in the same entry.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * @pathstr: the PATH string
+ * @cmd: the command to find, without any '/'
+ * Return: full path of cmd if found, owned by the table, or NULL
+ */
+char *hash_lookup(shell_t *data, char *pathstr, char *cmd)
+{
+	cmdtable_t *t = data->hash;
+	cmdhash_t *entry;
+	size_t len;
+
+	if (_strchr(cmd, '/'))
+		return (NULL);
+	if (!t)
+		t = data->hash = calloc(1, sizeof(cmdtable_t));
+	if (!t || hash_set_path(t, pathstr) == -1)
+		return (NULL);
+
+	entry = t->buckets[hash_line(cmd, &len) % CMD_HASH_SIZE];
+	while (entry && _strcmp(entry->name, cmd))
+		entry = entry->next;
+	if (entry && entry->path && *entry->path == '/')
+	{
+		if (hash_dirs_changed(t))
+			hash_flush(t, 0);
+		else
+		{
+			t->hits++;
+			entry->hits++;
+			return (entry->path);
+		}
+		entry = NULL;
+	}
+	t->misses++;
+	entry = hash_search(data, t, cmd, entry);
+	return (entry ? entry->path : NULL);
+}
+
+/**
+ * hash_set_path - makes the table follow the current PATH: when PATH
+ *		changed, every entry is dropped and the new directories
+ *		are recorded with their modification times.
+ * @t: the command hash table
+ * @pathstr: the PATH string
+ * Return: 0 on success, -1 if memory ran out
+ */
+int hash_set_path(cmdtable_t *t, char *pathstr)
+{
+	int i, start = 0, n = 0;
+	struct timespec now;
+	struct stat st;
+	pathdir_t *d;
+
+	if (t->path && !_strcmp(t->path, pathstr))
+		return (0);
+	hash_flush(t, 1);
+	clock_gettime(CLOCK_MONOTONIC_COARSE, &now);
+	t->checked = now.tv_sec;
+	for (i = 0; pathstr[i]; i++)
+		n += pathstr[i] == ':';
+	t->path = _strdup(pathstr);
+	t->dirs = calloc(n + 1, sizeof(pathdir_t));
+	if (!t->path || !t->dirs)
+		return (hash_flush(t, 1), -1);
+	for (i = 0; t->ndirs <= n; i++)
+		if (!pathstr[i] || pathstr[i] == ':')
+		{
+			d = &t->dirs[t->ndirs++];
+			d->dir = _strdup(duplicates(pathstr, start, i));
+			if (!d->dir)
+				return (hash_flush(t, 1), -1);
+			if (stat(d->dir, &st))
+				st.st_mtim.tv_sec = st.st_mtim.tv_nsec = -1;
+			d->mtime = st.st_mtim;
+			start = i;
+		}
+	return (0);
+}
+
+/**
+ * hash_dirs_changed - checks the absolute PATH directories against the
+ *		modification times recorded for them, at most once a second.
+ * Within the second of the last check the table is trusted as it is,
+ *		so a hit costs no stat(). Relative directories are skipped:
+ *		no trusted entry was found in one.
+ * @t: the command hash table
+ * Return: 1 if a directory changed, 0 otherwise
+ */
+int hash_dirs_changed(cmdtable_t *t)
+{
+	struct timespec now;
+	struct stat st;
+	int i, changed = 0;
+
+	clock_gettime(CLOCK_MONOTONIC_COARSE, &now);
+	if (now.tv_sec == t->checked)
+		return (0);
+	t->checked = now.tv_sec;
+	for (i = 0; i < t->ndirs; i++)
+	{
+		if (t->dirs[i].dir[0] != '/')
+			continue;
+		if (stat(t->dirs[i].dir, &st)) /* a missing directory */
+			st.st_mtim.tv_sec = st.st_mtim.tv_nsec = -1;
+		if (st.st_mtim.tv_sec != t->dirs[i].mtime.tv_sec ||
+				st.st_mtim.tv_nsec != t->dirs[i].mtime.tv_nsec)
+		{
+			t->dirs[i].mtime = st.st_mtim;
+			changed = 1;
+		}
+	}
+	return (changed);
+}
+
+/**
+ * hash_search - searches the PATH directories for a command
+ *		and remembers the result in the table.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * @t: the command hash table
+ * @cmd: the command to find
+ * @entry: the command's entry to update, NULL to add one
+ * Return: the entry, or NULL if memory ran out
+ */
+cmdhash_t *hash_search(shell_t *data, cmdtable_t *t, char *cmd,
+		cmdhash_t *entry)
+{
+	char path[PATH_MAX];
+	size_t len, bucket = hash_line(cmd, &len) % CMD_HASH_SIZE;
+	int i;
+
+	if (!entry)
+	{
+		entry = calloc(1, sizeof(cmdhash_t));
+		if (!entry || !(entry->name = _strdup(cmd)))
+			return (free(entry), NULL);
+		entry->next = t->buckets[bucket];
+		t->buckets[bucket] = entry;
+	}
+	free(entry->path);
+	entry->path = NULL;
+	for (i = 0; i < t->ndirs && !entry->path; i++)
+	{
+		if (_strlen(t->dirs[i].dir) + len + 2 > PATH_MAX)
+			continue;
+		_strcpy(path, t->dirs[i].dir);
+		if (*path)
+			_strcat(path, "/");
+		_strcat(path, cmd);
+		if (iscommand(data, path))
+			entry->path = _strdup(path);
+	}
+	return (entry);
+}
+
+/**
+ * hash_flush - forgets every command of the table.
+ * @t: the command hash table
+ * @all: true to also forget the PATH it follows
+ */
+void hash_flush(cmdtable_t *t, int all)
+{
+	cmdhash_t *entry, *next;
+	int i;
+
+	for (i = 0; i < CMD_HASH_SIZE; i++)
+	{
+		for (entry = t->buckets[i]; entry; entry = next)
+		{
+			next = entry->next;
+			free(entry->name);
+			free(entry->path);
+			free(entry);
+		}
+		t->buckets[i] = NULL;
+	}
+	if (!all)
+		return;
+	for (i = 0; i < t->ndirs; i++)
+		free(t->dirs[i].dir);
+	free(t->dirs);
+	free(t->path);
+	t->dirs = NULL;
+	t->path = NULL;
+	t->ndirs = 0;
+}
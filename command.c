@@ -0,0 +1,114 @@
+#include "shell.h"
+
+int resolve_command(shell_t *);
+void spawn_failed(shell_t *, int);
+int child_status(int);
+int make_pipe(int *, int);
+int spawn_backend(shell_t *);
+
+/**
+ * resolve_command - finds the executable to run for data->argv[0],
+ *		searching PATH through find_path() when it is a bare name.
+ * @data:  A pointer to the shell data structure,
+ * which contains information about the current state of the shell.
+ * Return: 1 with data->path set if there is something to execute,
+ *		0 with the status set to 127 if the command was not found.
+ */
+int resolve_command(shell_t *data)
+{
+	char *path = NULL;
+
+	data->path = data->argv[0];
+	path = find_path(data, _getenv(data, "PATH="), data->argv[0]);
+	if (path)
+	{
+		data->path = path;
+		return (1);
+	}
+	if ((interactive(data) ||
+				_getenv(data, "PATH=") ||
+				data->argv[0][0] == '/') &&
+			iscommand(data, data->argv[0]))
+		return (1);
+	data->status = 127;
+	_perror(data, "not found\n");
+	return (0);
+}
+
+/**
+ * spawn_failed - sets the status of a command that could not be started,
+ *		the status a child that failed to exec would have exited with.
+ * @data:  A pointer to the shell data structure,
+ * which contains information about the current state of the shell.
+ * @err: the error reported by spawn_command().
+ */
+void spawn_failed(shell_t *data, int err)
+{
+	if (err == EAGAIN || err == ENOMEM)
+	{
+		_eputs("Error:: ");
+		_eputs(strerror(err));
+		_eputs("\n");
+		data->status = 2;
+		return;
+	}
+	data->status = err == EACCES ? 126 : 1;
+	if (data->status == 126)
+		_perror(data, "Permission denied\n");
+}
+
+/**
+ * child_status - turns a status reported by waitpid() into the shell's
+ *		exit status: the exit code, or 128 plus the killing signal.
+ * @status: the status reported by waitpid().
+ * Return: the exit status.
+ */
+int child_status(int status)
+{
+	if (WIFSIGNALED(status))
+		return (128 + WTERMSIG(status));
+	if (!WIFEXITED(status))
+		return (status);
+	return (WEXITSTATUS(status));
+}
+
+/**
+ * make_pipe - creates a pipe whose ends are closed on exec, so that
+ *		a child only keeps the ends installed as its 0 and 1.
+ * @fds: receives the read and write ends.
+ * @size: the capacity to give the pipe, 0 to keep the kernel's default.
+ *		A size the kernel refuses is not an error.
+ * Return: 0 on success, -1 on failure.
+ */
+int make_pipe(int *fds, int size)
+{
+	if (pipe2(fds, O_CLOEXEC) == -1)
+		return (-1);
+#ifdef F_SETPIPE_SZ
+	if (size > 0)
+		fcntl(fds[1], F_SETPIPE_SZ, size);
+#else
+	(void)size;
+#endif
+	return (0);
+}
+
+/**
+ * spawn_backend - reads the spawn backend from the HSH_SPAWN variable:
+ *		"fork", "vfork" or "posix_spawn", which is the default.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * Return: one of the SPAWN_* values.
+ */
+int spawn_backend(shell_t *data)
+{
+	char *name = _getenv(data, "HSH_SPAWN=");
+
+	if (name && !_strcmp(name, "fork"))
+		return (SPAWN_FORK);
+	if (name && !_strcmp(name, "vfork"))
+		return (SPAWN_VFORK);
+	if (name && !_strcmp(name, "zygote"))
+		return (SPAWN_ZYGOTE);
+	return (SPAWN_POSIX);
+}
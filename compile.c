@@ -0,0 +1,140 @@
+#include "shell.h"
+
+int compile_script(shell_t *, program_t *);
+int emit_command(program_t *, char *, int, unsigned int);
+int program_reserve(program_t *);
+void free_program(program_t *);
+void emit_time(program_t *, insn_t *);
+
+/**
+ * compile_script - reads the whole script and compiles it into a program,
+ *		so every line is split into words only once.
+ * Aliases and variables are still expanded when each command runs,
+ *		since the script itself may change them along the way.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * @prog: the program to fill, zeroed by the caller.
+ * Return: 0 on success, -1 if memory ran out.
+ */
+int compile_script(shell_t *data, program_t *prog)
+{
+	char *line = NULL;
+	unsigned int lineno = 0;
+	int read;
+
+	while ((read = _getline(data, &line, NULL)) != -1)
+	{
+		lineno++;
+		if (read && line[read - 1] == '\n')
+			line[read - 1] = '\0';
+		remove_comments(line);
+		/* words point into the line, read() buffers do not keep it */
+		if (!data->map && (!(line = _strdup(line)) ||
+					strvec_push(&prog->text, line) == -1))
+			return (free(line), -1);
+		if (compile_line(prog, line, lineno) == -1)
+			return (-1);
+	}
+	return (0);
+}
+
+/**
+ * emit_command - splits a command into words, straight into the program's
+ *		word pool, and appends its instruction.
+ * @prog: the program being compiled.
+ * @command: the text of one command.
+ * @cond: when the command runs, one of the RUN_* values.
+ * @lineno: the line number, kept for error messages.
+ * Return: the number of words and redirections, -1 if memory ran out,
+ *		or -2 if a redirection has no target.
+ */
+int emit_command(program_t *prog, char *command, int cond,
+		unsigned int lineno)
+{
+	size_t first = prog->words.len, i;
+	insn_t *in;
+	int argc;
+
+	if (program_reserve(prog) == -1)
+		return (-1);
+	argc = tokenize(command, blank_delims, &prog->words);
+	if (argc < 1)
+	{
+		prog->words.len = first;
+		return (argc);
+	}
+	in = &prog->code[prog->len];
+	argc = emit_redirs(prog, first, in);
+	if (argc < 0)
+	{
+		prog->words.len = first;
+		prog->nredirs = in->redir;
+		return (argc);
+	}
+	prog->len++;
+	in->cond = cond;
+	in->argv = first;
+	in->line = lineno;
+	in->async = 0;
+	in->vars = 0;
+	for (i = first; prog->words.v[i]; i++)
+		in->vars |= _strchr(prog->words.v[i], '$') != NULL;
+	in->timed = 0;
+	emit_time(prog, in);
+	return (in->argc + in->nredir);
+}
+
+/**
+ * program_reserve - makes room for one more instruction.
+ * @prog: the program being compiled.
+ * Return: 0 on success, -1 if memory ran out.
+ */
+int program_reserve(program_t *prog)
+{
+	insn_t *code;
+
+	if (prog->len == prog->cap)
+	{
+		code = realloc(prog->code,
+				sizeof(insn_t) * (prog->cap * 2 + 16));
+		if (!code)
+			return (-1);
+		prog->code = code;
+		prog->cap = prog->cap * 2 + 16;
+	}
+	return (0);
+}
+
+/**
+ * free_program - frees a compiled program and the line copies it owns.
+ * @prog: the program.
+ */
+void free_program(program_t *prog)
+{
+	strvec_clear(&prog->text);
+	strvec_free(&prog->text);
+	strvec_free(&prog->words);
+	free(prog->code);
+	free(prog->redirs);
+	memset(prog, 0, sizeof(*prog));
+}
+
+/**
+ * emit_time - drops the time keyword in front of a command, and marks
+ *		the pipeline the command belongs to as timed.
+ * A time without a command after it stays a word, the time builtin.
+ * @prog: the program being compiled.
+ * @in: the command's instruction, the last of the program.
+ */
+void emit_time(program_t *prog, insn_t *in)
+{
+	size_t head = prog->len - 1;
+
+	if (in->argc < 2 || _strcmp(prog->words.v[in->argv], "time"))
+		return;
+	in->argv++;
+	in->argc--;
+	while (head && prog->code[head].cond == RUN_PIPED)
+		head--;
+	prog->code[head].timed = 1;
+}
@@ -2,7 +2,7 @@
 
 void _eputs(char *);
 int _puts2(char);
-int _write(char, int);
+void flush_output(shell_t *);
 void _puts(char *);
 int _putchar(char);
 
@@ -15,62 +15,39 @@ int _putchar(char);
  */
 void _eputs(char *massage)
 {
-	int i = 0;
-
 	if (!massage)
 		return;
 	/* returns without performing any further actions. */
-	while (massage[i] != '\0')
-	{
-		_puts2(massage[i]);
-		i++;
-	}
+	out_write(STDERR_FILENO, massage, _strlen(massage));
 }
 
 /**
  * _puts2 - a modified version of the puts() function
  * used for writing characters to the standard error stream (file descriptor 2)
- * @c: A character to be written to the file descriptor.
+ * @c: A character to be written to the file descriptor, or BUF_FLUSH
+ *		to write out all the buffered output.
  * Return: On success 1.
  * On error, -1 is returned, and errno is set appropriately.
  */
 int _puts2(char c)
 {
-	static int i;
-	static char buffer[WRITE_BUF_SIZE];
-
-	if (c == (char)BUF_FLUSH || i >= WRITE_BUF_SIZE)
-	{
-		write(2, buffer, i);
-		i = 0;
-	}
-	if (c != (char)BUF_FLUSH)
-		buffer[i++] = c;
-	return (1);
+	if (c == (char)BUF_FLUSH)
+		return (out_flush(-1) == -1 ? -1 : 1);
+	return (out_write(STDERR_FILENO, &c, 1) == -1 ? -1 : 1);
 }
 
 /**
- * _write - a helper function used to write a character to a file descriptor.
- * It resembles the write() system call.
- * @c: A character to be written to the file descriptor.
- * @fd: the file descriptor to which the character will be written.
- * Return: always returns 1,
- *				which is typically used to indicate success or that data was written.
+ * flush_output - writes out the output of a command that is done.
+ * An interactive shell writes everything out. Otherwise only errors are,
+ *		and standard output is kept until the buffer fills, a child is
+ *		started, the shell waits or reads, or it exits, so that a run
+ *		of builtins makes one write() rather than one each.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
  */
-int _write(char c, int fd)
+void flush_output(shell_t *data)
 {
-	static int position;
-	static char buffer[WRITE_BUF_SIZE];
-
-	if (c == '\0' || position >= (int)WRITE_BUF_SIZE)
-	{
-		write(fd, buffer, position);
-		position = 0;
-		/* resets the position back to 0. */
-	}
-	if (c != '\0')
-		buffer[position++] = c;
-	return (1);
+	out_flush(interactive(data) ? -1 : STDERR_FILENO);
 }
 
 /**
@@ -80,37 +57,24 @@ int _write(char c, int fd)
  */
 void _puts(char *string)
 {
-	int i = 0;
-
 	if (!string)
 		return;
-	while (string[i] != '\0')
-	{
-		_putchar(string[i]);
-		i++;
-	}
+	out_write(STDOUT_FILENO, string, _strlen(string));
 }
 
 /**
  * _putchar - a custom implementation of the putchar() function.
  * It writes a single character to the standard output.
- * @c: A character to be written to the standard output.
+ * @c: A character to be written to the standard output, or BUF_FLUSH
+ *		to write out all the buffered output.
  * Return: returns 1 to indicate that the character has been successfully
  *									written.
  */
 int _putchar(char c)
 {
-	static int i;
-	static char buffer[WRITE_BUF_SIZE];
-
-	if (c == '\0' || i >= WRITE_BUF_SIZE)
-	{
-		write(1, buffer, i);
-		i = 0;
-	}
-	if (c != '\0')
-		buffer[i++] = c;
+	if (c == (char)BUF_FLUSH)
+		out_flush(-1);
+	else
+		out_write(STDOUT_FILENO, &c, 1);
 	return (1);
 }
-
-
@@ -0,0 +1,143 @@
+#include "shell.h"
+
+dirlist_t *dir_list(shell_t *, char *);
+int dir_read(dirlist_t *, char *);
+void dir_cache_flush(shell_t *);
+void free_dir_cache(shell_t *);
+
+/**
+ * dir_list - lists the names in a directory for pathname expansion,
+ *		reading the directory only if it is not cached or it was
+ *		modified since it was read.
+ * Directories are known by device and inode, so that the same one is
+ *		cached once whatever path leads to it. The cache lasts as long
+ *		as the command list being run, and the listings of the previous
+ *		ones are read into again. A directory modified in the
+ *		last second or so is read every time: its modification time
+ *		only has the clock's resolution, and would not change again
+ *		if it was modified twice within a tick. A listing is not read
+ *		again for the command that used it, whose words point into it,
+ *		nor while its names are being matched.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * @path: the directory.
+ * Return: the listing, or NULL if the directory cannot be read.
+ */
+dirlist_t *dir_list(shell_t *data, char *path)
+{
+	struct stat st;
+	struct timespec now;
+	dirlist_t *d, *old = NULL;
+
+	if (stat(path, &st) == -1 || !S_ISDIR(st.st_mode))
+		return (NULL);
+	for (d = data->dirs; d; d = d->next)
+		if (d->dev == st.st_dev && d->ino == st.st_ino)
+			break;
+		else if (d->stale)
+			old = d;
+	if (d && !d->stale && (d->cmdno == data->cmdno || (!d->racy &&
+			d->mtime.tv_sec == st.st_mtim.tv_sec &&
+			d->mtime.tv_nsec == st.st_mtim.tv_nsec)))
+		return (d->cmdno = data->cmdno, d);
+	if (!d && !old)
+	{
+		old = calloc(1, sizeof(dirlist_t));
+		if (!old)
+			return (NULL);
+		old->next = data->dirs;
+		data->dirs = old;
+	}
+	d = d ? d : old;
+	d->dev = st.st_dev;
+	d->ino = st.st_ino;
+	d->stale = 0;
+	d->mtime = st.st_mtim;
+	clock_gettime(CLOCK_REALTIME, &now);
+	d->racy = now.tv_sec - st.st_mtim.tv_sec < 2;
+	if (dir_read(d, path) == -1)
+	{
+		d->stale = 1; /* read it again */
+		return (NULL);
+	}
+	d->cmdno = data->cmdno;
+	return (d);
+}
+
+/**
+ * dir_read - reads the names of a directory, "." and ".." left out,
+ *		with their types.
+ * It uses getdents64() into a buffer on the stack rather than readdir(),
+ *		which would allocate one for each directory opened.
+ * @d: the listing, whose previous names are dropped.
+ * @path: the directory.
+ * Return: 0 on success, -1 on failure.
+ */
+int dir_read(dirlist_t *d, char *path)
+{
+	int fd = open(path, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+	char buf[WALK_BUF_SIZE], *s, type;
+	struct dirent64 *e;
+	ssize_t n, pos;
+	size_t i;
+
+	d->blob.len = d->types.len = d->names.len = 0;
+	if (fd == -1)
+		return (-1);
+	while ((n = getdents64(fd, buf, sizeof(buf))) > 0)
+		for (pos = 0; pos < n; pos += e->d_reclen)
+		{
+			e = (struct dirent64 *)(buf + pos);
+			if (!_strcmp(e->d_name, ".") ||
+					!_strcmp(e->d_name, ".."))
+				continue;
+			type = e->d_type;
+			if (strbuf_add(&d->blob, e->d_name,
+						_strlen(e->d_name) + 1) == -1 ||
+					strbuf_add(&d->types, &type, 1) == -1)
+				return (close(fd), -1);
+		}
+	close(fd);
+	/* the blob is done growing: the names can point into it */
+	for (s = d->blob.s, i = 0; i < d->types.len; i++)
+	{
+		if (strvec_push(&d->names, s) == -1)
+			return (-1);
+		s += _strlen(s) + 1;
+	}
+	return (0);
+}
+
+/**
+ * dir_cache_flush - forgets the directory listings once the command list
+ *		they were read for is done, keeping their memory for the next.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ */
+void dir_cache_flush(shell_t *data)
+{
+	dirlist_t *d;
+
+	for (d = data->dirs; d; d = d->next)
+		d->stale = 1;
+}
+
+/**
+ * free_dir_cache - frees the directory listings.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ */
+void free_dir_cache(shell_t *data)
+{
+	dirlist_t *d, *next;
+
+	for (d = data->dirs; d; d = next)
+	{
+		next = d->next;
+		free(d->blob.s);
+		free(d->types.s);
+		strvec_free(&d->names);
+		free(d);
+	}
+	data->dirs = NULL;
+}
@@ -0,0 +1,157 @@
+#include "shell.h"
+
+unsigned long env_hash(const char *, size_t);
+size_t env_probe(envtab_t *, const char *, size_t, unsigned long);
+int env_put(envtab_t *, char *);
+int env_remove(envtab_t *, const char *, size_t);
+int env_rehash(envtab_t *);
+
+/**
+ * env_hash - computes the FNV-1a hash of a variable name.
+ * @name: the name, not necessarily terminated after it.
+ * @nlen: the length of the name.
+ * Return: the hash.
+ */
+unsigned long env_hash(const char *name, size_t nlen)
+{
+	unsigned long hash = 2166136261UL;
+	size_t i;
+
+	for (i = 0; i < nlen; i++)
+	{
+		hash ^= (unsigned char)name[i];
+		hash *= 16777619UL;
+	}
+	return (hash);
+}
+
+/**
+ * env_probe - finds the slot of a variable in the environment table.
+ * Probing goes on past unset variables and stops at a never used slot,
+ *		of which the table always has some.
+ * @t: the table, with slots allocated.
+ * @name: the variable's name.
+ * @nlen: the length of the name.
+ * @hash: the hash of the name.
+ * Return: the variable's slot, or if it is not set, the slot to set it in.
+ */
+size_t env_probe(envtab_t *t, const char *name, size_t nlen,
+		unsigned long hash)
+{
+	size_t i, mask = t->nslots - 1, gone = t->nslots;
+	envent_t *e;
+
+	for (i = hash & mask; t->slots[i] != ENV_FREE; i = (i + 1) & mask)
+	{
+		if (t->slots[i] == ENV_GONE)
+		{
+			if (gone == t->nslots)
+				gone = i;
+			continue;
+		}
+		e = &t->ents[t->slots[i]];
+		if (e->hash == hash && e->nlen == nlen &&
+				!memcmp(t->envp[t->slots[i]], name, nlen))
+			return (i);
+	}
+	return (gone != t->nslots ? gone : i);
+}
+
+/**
+ * env_put - sets a variable, in place if it is already set, or else
+ *		after the others, patching envp either way.
+ * @t: the table.
+ * @str: the variable as NAME=value, owned by the table from now on.
+ * Return: 0 on success, -1 if memory ran out.
+ */
+int env_put(envtab_t *t, char *str)
+{
+	char *eq = _strchr(str, '=');
+	size_t nlen = eq ? (size_t)(eq - str) : (size_t)_strlen(str), i;
+	unsigned long hash = env_hash(str, nlen);
+	envent_t *e;
+
+	if (t->len == t->cap && env_rehash(t) == -1)
+	{
+		free(str);
+		return (-1);
+	}
+	i = env_probe(t, str, nlen, hash);
+	if (t->slots[i] >= 0)
+	{
+		free(t->envp[t->slots[i]]);
+		t->envp[t->slots[i]] = str;
+		return (0);
+	}
+	t->slots[i] = t->len;
+	t->envp[t->len] = str;
+	e = &t->ents[t->len++];
+	t->envp[t->len] = NULL;
+	e->nlen = nlen;
+	e->hash = hash;
+	t->count++;
+	return (0);
+}
+
+/**
+ * env_remove - unsets a variable, leaving a hole in the order and
+ *		a marker in its slot.
+ * The hole is closed when envp is next asked for, so that unsetting
+ *		several variables moves the others only once.
+ * @t: the table.
+ * @name: the variable's name.
+ * @nlen: the length of the name.
+ * Return: 1 if the variable was set, 0 otherwise.
+ */
+int env_remove(envtab_t *t, const char *name, size_t nlen)
+{
+	size_t i;
+
+	if (!t->nslots)
+		return (0);
+	i = env_probe(t, name, nlen, env_hash(name, nlen));
+	if (t->slots[i] < 0)
+		return (0);
+	free(t->envp[t->slots[i]]);
+	t->envp[t->slots[i]] = NULL;
+	t->slots[i] = ENV_GONE;
+	t->count--;
+	t->holes++;
+	return (1);
+}
+
+/**
+ * env_rehash - makes room in a full table: grows the entries to twice
+ *		the variables, then closes the holes and rebuilds the slots.
+ * @t: the table.
+ * Return: 0 on success, -1 if memory ran out.
+ */
+int env_rehash(envtab_t *t)
+{
+	size_t cap = (t->count + 1) * 2, n = 64;
+	envent_t *ents;
+	char **envp;
+	long *slots;
+
+	if (cap < 32)
+		cap = 32;
+	if (cap < t->len)
+		cap = t->len;
+	while (n < cap * 2)
+		n *= 2;
+	slots = malloc(sizeof(long) * n);
+	ents = slots ? realloc(t->ents, sizeof(envent_t) * cap) : NULL;
+	if (ents)
+		t->ents = ents;
+	envp = ents ? realloc(t->envp, sizeof(char *) * (cap + 1)) : NULL;
+	if (!envp)
+		return (free(slots), -1);
+	t->envp = envp;
+	t->cap = cap;
+	free(t->slots);
+	t->slots = slots;
+	t->nslots = n;
+	t->holes = 1; /* the slots are to be built */
+	env_compact(t);
+	return (0);
+}
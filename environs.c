@@ -1,50 +1,65 @@
 #include "shell.h"
 
 char *_getenv(shell_t *, const char *);
+char *env_value(envtab_t *, const char *, size_t);
 int _unsetenv(shell_t *, char *);
 int _setenv(shell_t *, char *, char *);
-char **get_environ(shell_t *);
+void env_free(envtab_t *);
 
 /**
  * _getenv - allows the shell program to retrieve
  *			the value of a specific environment variable based on its name.
- * It searches through the linked list of environment variables
- *		and returns the value associated with the specified name.
+ * It looks the name up in the shell variables, then in the environment,
+ *		as the shell sees both.
  * @data: A pointer to the shell data structure,
  *		which contains information about the current state of the shell.
- * @name: the name of the environment variable whose value is to be retrieved.
+ * @name: the name of the environment variable whose value is to be retrieved,
+ *		with or without a trailing '='.
  * Return: returns NULL to indicate that the environ variable was not found.
  */
 char *_getenv(shell_t *data, const char *name)
 {
-	list_t *node = data->env;
-	char *env;
+	size_t nlen = _strlen((char *)name);
+	char *value;
 
-	while (node)
-	{
-		env = _strstr(node->string, name);
-		if (env && *env)
-			return (env);
-		node = node->next;
-	}
-	return (NULL);
+	if (nlen && name[nlen - 1] == '=')
+		nlen--;
+	value = env_value(&data->vars, name, nlen);
+	return (value ? value : env_value(&data->env, name, nlen));
+}
+
+/**
+ * env_value - looks a variable up in the environment's hash table.
+ * @t: the table.
+ * @name: the variable's name, not necessarily terminated after it.
+ * @nlen: the length of the name.
+ * Return: the variable's value, or NULL if it is not set.
+ */
+char *env_value(envtab_t *t, const char *name, size_t nlen)
+{
+	size_t i;
+
+	if (!t->nslots)
+		return (NULL);
+	i = env_probe(t, name, nlen, env_hash(name, nlen));
+	if (t->slots[i] < 0)
+		return (NULL);
+	return (t->envp[t->slots[i]] + nlen + 1);
 }
 
 /**
  * _setenv - for setting or updating environment variables within the shell's
- *		environment by either updating an existing node in the linked list
- * or appending a new node.
+ *		environment, in place if the variable is already set,
+ *		or after the others. A shell variable of that name is exported.
  * @data: A pointer to the shell data structure,
  *		which contains information about the current state of the shell.
  * @name: the name of the environment variable to set or modify.
  * @value: the value to assign to the environment variable.
- *  Return: returns 0 to indicate success.
+ *  Return: returns 0 to indicate success, 1 if memory ran out.
  */
 int _setenv(shell_t *data, char *name, char *value)
 {
 	char *buffer = NULL;
-	list_t *node;
-	char *env;
 
 	if (!name || !value)
 		return (0);
@@ -55,23 +70,8 @@ int _setenv(shell_t *data, char *name, char *value)
 	_strcpy(buffer, name);
 	_strcat(buffer, "=");
 	_strcat(buffer, value);
-	node = data->env;
-	while (node)
-	{
-		env = _strstr(node->string, name);
-		if (env && *env == '=')
-		{
-			free(node->string);
-			node->string = buffer;
-			data->modified = 1;
-			return (0);
-		}
-		node = node->next;
-	}
-	append_node(&(data->env), buffer, 0);
-	free(buffer);
-	data->modified = 1;
-	return (0);
+	env_remove(&data->vars, name, _strlen(name));
+	return (env_put(&data->env, buffer) == -1);
 }
 
 /**
@@ -81,49 +81,27 @@ int _setenv(shell_t *data, char *name, char *value)
  * @data: A pointer to the shell data structure,
  *		which contains information about the current state of the shell.
  * @name: the name of the environment variable to be unset.
- * Return: returns data->modified, which indicates whether
- *		any modifications were made to the environment variables.
+ * Return: 1 if the variable was set, 0 otherwise.
  */
 int _unsetenv(shell_t *data, char *name)
 {
-	list_t *node = data->env;
-	size_t counter = 0;
-	char *env;
-
-	if (!node || !name)
+	if (!name)
 		return (0);
-
-	while (node)
-	{
-		env = _strstr(node->string, name);
-		if (env && *env == '=')
-		{
-			data->modified = remove_index(&(data->env), counter);
-			counter = 0;
-			node = data->env;
-			continue;
-		}
-		node = node->next;
-		counter++;
-	}
-	return (data->modified);
+	return (env_remove(&data->env, name, _strlen(name)));
 }
 
 /**
- * get_environ - retrieve the environment variables as an array of strings.
- * @data: A pointer to the shell data structure,
- *		which contains information about the current state of the shell.
- * Return: returns the environ field,
- *		which now contains the environment variables as an array of strings.
+ * env_free - frees every variable of the environment table.
+ * @t: the table.
  */
-char **get_environ(shell_t *data)
+void env_free(envtab_t *t)
 {
-	if (!data->environ || data->modified)
-	{
-		data->environ = list_to_strings(data->env);
-		data->modified = 0;
-	}
+	size_t i;
 
-	return (data->environ);
+	for (i = 0; i < t->len; i++)
+		free(t->envp[i]);
+	free(t->envp);
+	free(t->ents);
+	free(t->slots);
+	memset(t, 0, sizeof(*t));
 }
-
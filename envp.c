@@ -0,0 +1,49 @@
+#include "shell.h"
+
+char **get_environ(shell_t *);
+void env_compact(envtab_t *);
+
+/**
+ * get_environ - retrieve the environment variables as an array of strings.
+ * The array is the table's own, patched in place as variables are set
+ *		and unset, so that it costs nothing when nothing changed.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * Return: the NULL terminated environment, valid until the next change.
+ */
+char **get_environ(shell_t *data)
+{
+	static char *empty[] = {NULL};
+
+	if (!data->env.envp)
+		return (empty);
+	if (data->env.holes)
+		env_compact(&data->env);
+	return (data->env.envp);
+}
+
+/**
+ * env_compact - closes the holes left by unset variables, keeping the
+ *		others in order, and rebuilds the slots, which also clears
+ *		the markers of the unset variables.
+ * @t: the table, with slots allocated.
+ */
+void env_compact(envtab_t *t)
+{
+	size_t i, j;
+
+	for (i = j = 0; i < t->len; i++)
+		if (t->envp[i])
+		{
+			t->ents[j] = t->ents[i];
+			t->envp[j++] = t->envp[i];
+		}
+	t->len = j;
+	t->envp[j] = NULL;
+	t->holes = 0;
+	for (i = 0; i < t->nslots; i++)
+		t->slots[i] = ENV_FREE;
+	for (i = 0; i < t->len; i++)
+		t->slots[env_probe(t, t->envp[i], t->ents[i].nlen,
+					t->ents[i].hash)] = i;
+}
@@ -1,9 +1,7 @@
 #include "shell.h"
 
 int execute(shell_t *, char **);
-void set_data(shell_t *, char **);
 int replace_vars(shell_t *);
-int strep(char **, char *);
 char *_itoa(long int, int, int);
 
 /**
@@ -19,19 +17,22 @@ int execute(shell_t *data, char **argv)
 	ssize_t reads = 0;
 	int result = 0;
 
+	if (data->file_descriptor > 2) /* a script: compile it, then run it */
+		result = execute_script(data, argv);
 	while (reads != -1 && result != -2)
 	{
 		clear_data(data);
 		if (interactive(data))
+		{
+			notify_jobs(data);
 			_puts("$ ");
-		_puts2(BUF_FLUSH);
+			_puts2(BUF_FLUSH);
+		}
 		reads = get_input(data);
 		if (reads != -1)
 		{
-			set_data(data, argv);
-			result = find_builtin(data);
-			if (result == -1)
-				execute_wildcard(data);
+			data->fname = argv[0];
+			result = run_line(data, argv);
 		}
 		else if (interactive(data))
 			_putchar('\n');
@@ -50,99 +51,36 @@ int execute(shell_t *data, char **argv)
 }
 
 /**
- * set_data - setting up the shell data structure based
- *		on the command-line arguments provided to the shell program.
- * @data: A pointer to the shell data structure,
- *		which contains information about the current state of the shell.
- * @argv: array of strings representing the command line arguments.
- */
-void set_data(shell_t *data, char **argv)
-{
-	int i = 0;
-
-	data->fname = argv[0];
-	if (data->arg)
-	{
-		data->argv = strtow(data->arg, " \t");
-		if (!data->argv)
-		{
-			data->argv = malloc(sizeof(char *) * 2);
-			if (data->argv)
-			{
-				data->argv[0] = _strdup(data->arg);
-				data->argv[1] = NULL;
-			}
-		}
-		for (i = 0; data->argv && data->argv[i]; i++)
-		/* an empty statement inside the loop body. */
-			;
-		data->argc = i;
-		replace_alias(data);
-		replace_vars(data);
-	}
-}
-
-/**
- * replace_vars - replacing variables in command arguments with their
- *			corresponding values. typically called before executing
- *			a command to ensure that any variable references in the
- *			command arguments are replaced with their corresponding values.
- *		This allows the shell to substitute variables
- *		dynamically during command execution.
+ * replace_vars - replaces the parameters in the words of the command,
+ *		$NAME and ${NAME} anywhere in a word, $?, $$ and $!, with
+ *		their values.
+ * The words that have a '$' are expanded one after the other into the
+ *		scratch buffer, then pointed at there once it is done growing;
+ *		the other words are not touched.
  * @data: A pointer to the shell data structure,
  *		which contains information about the current state of the shell.
- * Return: returns 0 to indicate successful completion.
+ * Return: returns 0 on success, -1 if memory ran out.
  */
 int replace_vars(shell_t *data)
 {
-	int i = 0;
-	list_t *node;
+	char *p;
+	int i;
 
+	data->scratch.len = 0;
 	for (i = 0; data->argv[i]; i++)
-	{
-		if (data->argv[i][0] != '$' || !data->argv[i][1])
-			continue;
-		if (!_strcmp(data->argv[i], "$?"))
-		{
-			strep(&(data->argv[i]), _strdup(_itoa(data->status, 10, 0)));
-			continue;
-		}
-		if (!_strcmp(data->argv[i], "$$"))
-		{
-			strep(&(data->argv[i]), _strdup(_itoa(getpid(), 10, 0)));
-			continue;
-		}
-		node = node_prefix(data->env, &data->argv[i][1], '=');
-		if (node)
+		if (_strchr(data->argv[i], '$') &&
+				expand_word(data, data->argv[i]) == -1)
+			return (-1);
+	p = data->scratch.s;
+	for (i = 0; data->argv[i]; i++)
+		if (_strchr(data->argv[i], '$'))
 		{
-			strep(&(data->argv[i]), _strdup(_strchr(node->string, '=') + 1));
-			continue;
+			data->argv[i] = p;
+			p += _strlen(p) + 1;
 		}
-		/* If none of the above cases apply, the arg is replaced with an empty str*/
-		strep(&data->argv[i], _strdup(""));
-	}
-
 	return (0);
 }
 
-
-/**
- * strep - utility function that helps in replacing the value of a pointer.
- *		used in cases where you have a pointer to a string that needs
- *		to be updated dynamically with a new value.
- *	It simplifies the process of replacing the old string with the new one
- *		while correctly handling memory allocation and deallocation.
- * @old: original string that needs to be replaced.
- * @new: the new string that will replace the old one.
- * Return: returns 1 to indicate that the replacement was successful.
- */
-int strep(char **old, char *new)
-{
-	free(*old);
-	*old = new;
-	return (1);
-}
-
 /**
  * _itoa - converts an integer to a string representation in a given base.
  *	It resembles the standard library function itoa() (integer to ASCII).
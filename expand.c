@@ -0,0 +1,158 @@
+#include "shell.h"
+
+int expand_word(shell_t *, char *);
+size_t param_name(char *, char **);
+int expand_param(shell_t *, char *, size_t);
+int strbuf_number(strbuf_t *, long);
+int strbuf_add(strbuf_t *, const char *, size_t);
+
+/**
+ * expand_word - appends a word to the scratch buffer with its parameters
+ *		replaced by their values, in a single scan of the word.
+ * A '$' that starts no parameter is kept as it is.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * @word: the word.
+ * Return: 0 on success, -1 if memory ran out.
+ */
+int expand_word(shell_t *data, char *word)
+{
+	char *end, *name;
+	size_t nlen;
+
+	while (*word)
+	{
+		for (end = word; *end && *end != '$'; end++)
+			;
+		if (strbuf_add(&data->scratch, word, end - word) == -1)
+			return (-1);
+		if (!*end)
+			break;
+		nlen = param_name(end + 1, &name);
+		if (!nlen)
+		{
+			if (strbuf_add(&data->scratch, "$", 1) == -1)
+				return (-1);
+			word = end + 1;
+			continue;
+		}
+		if (expand_param(data, name, nlen) == -1)
+			return (-1);
+		word = name + nlen + (end[1] == '{');
+	}
+	return (strbuf_add(&data->scratch, "", 1));
+}
+
+/**
+ * param_name - finds the name of the parameter after a '$': a name of
+ *		letters, digits and underscores, one of the special parameters
+ *		'?', '$' and '!' or a digit, or anything between braces.
+ * @s: the characters after the '$'.
+ * @name: receives the start of the name.
+ * Return: the length of the name, 0 if the '$' starts no parameter.
+ */
+size_t param_name(char *s, char **name)
+{
+	size_t n = 0;
+
+	*name = s;
+	if (*s == '{')
+	{
+		*name = ++s;
+		while (s[n] && s[n] != '}')
+			n++;
+		return (s[n] ? n : 0);
+	}
+	if (*s == '?' || *s == '$' || *s == '!' || (*s >= '0' && *s <= '9'))
+		return (1);
+	while (IS_NAME_CHAR(s[n]))
+		n++;
+	return (n);
+}
+
+/**
+ * expand_param - appends the value of a parameter to the scratch buffer:
+ *		$?, $$ and $!, $0 the shell's name, the HSH_* variables of the
+ *		last command's usage, or a shell or environment variable,
+ *		nothing if it is not set.
+ * $1 to $9 expand to nothing, the shell taking no positional parameters.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * @name: the name, not terminated after it.
+ * @nlen: the length of the name.
+ * Return: 0 on success, -1 if memory ran out.
+ */
+int expand_param(shell_t *data, char *name, size_t nlen)
+{
+	char *value;
+	int result;
+
+	if (nlen == 1 && (*name == '?' || *name == '$' || *name == '!'))
+		return (strbuf_number(&data->scratch, *name == '?' ?
+					data->status : *name == '$' ?
+					getpid() : data->last_bg));
+	if (nlen == 1 && *name >= '0' && *name <= '9')
+		return (*name != '0' || !data->fname ? 0 : strbuf_add(
+					&data->scratch, data->fname,
+					_strlen(data->fname)));
+	if (nlen > 4 && !memcmp(name, "HSH_", 4))
+	{
+		result = usage_var(data, name, nlen, &data->scratch);
+		if (result)
+			return (result == -1 ? -1 : 0);
+	}
+	value = env_value(&data->vars, name, nlen);
+	if (!value)
+		value = env_value(&data->env, name, nlen);
+	if (!value)
+		return (0);
+	return (strbuf_add(&data->scratch, value, _strlen(value)));
+}
+
+/**
+ * strbuf_number - appends a number, in decimal, to a buffer, without
+ *		going through a string of its own.
+ * @sb: the buffer.
+ * @n: the number.
+ * Return: 0 on success, -1 if memory ran out.
+ */
+int strbuf_number(strbuf_t *sb, long n)
+{
+	char digits[24], *p = digits + sizeof(digits);
+	unsigned long u = n < 0 ? -(unsigned long)n : (unsigned long)n;
+
+	do {
+		*--p = '0' + u % 10;
+		u /= 10;
+	} while (u);
+	if (n < 0)
+		*--p = '-';
+	return (strbuf_add(sb, p, digits + sizeof(digits) - p));
+}
+
+/**
+ * strbuf_add - appends bytes to a buffer, doubling its size as needed.
+ * @sb: the buffer.
+ * @s: the bytes.
+ * @n: the number of bytes.
+ * Return: 0 on success, -1 if memory ran out.
+ */
+int strbuf_add(strbuf_t *sb, const char *s, size_t n)
+{
+	size_t cap = sb->cap ? sb->cap : 256;
+	char *p;
+
+	while (sb->len + n > cap)
+		cap *= 2;
+	if (cap != sb->cap)
+	{
+		p = realloc(sb->s, cap);
+		if (!p)
+			return (-1);
+		sb->s = p;
+		sb->cap = cap;
+	}
+	memcpy(sb->s + sb->len, s, n);
+	sb->len += n;
+	return (0);
+}
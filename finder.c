@@ -1,6 +1,8 @@
 #include "shell.h"
 
 int find_builtin(shell_t *);
+int run_builtin(shell_t *, builtin_t *);
+builtin_t *lookup_builtin(char *);
 void clear_data(shell_t *);
 void sigintHandler(int);
 
@@ -15,24 +17,73 @@ void sigintHandler(int);
  */
 int find_builtin(shell_t *data)
 {
-	int i, value = -1;
-	builtin_t builtins[] = {
+	builtin_t *builtin = lookup_builtin(data->argv[0]);
+
+	if (!builtin)
+		return (-1);
+	return (run_builtin(data, builtin));
+}
+
+/**
+ * run_builtin - runs a built-in command in the shell itself
+ *		and makes what it returns the shell's status.
+ * @data: A pointer to the shell data structure,
+ *	which contains information about the current state of the shell.
+ * @builtin: the builtin.
+ * Return: the builtin's return value, -2 when exit was run.
+ */
+int run_builtin(shell_t *data, builtin_t *builtin)
+{
+	int value = builtin->func(data);
+
+	if (value >= 0)
+		data->status = value;
+	return (value);
+}
+
+/**
+ * lookup_builtin - finds a built-in command by name.
+ * A command starting with an assignment is run by the "=" builtin.
+ * @name: the command's name
+ * Return: the builtin's entry, or NULL if there is no such builtin.
+ */
+builtin_t *lookup_builtin(char *name)
+{
+	int i;
+	static builtin_t builtins[] = {
+		{"echo", echo_builtin},
+		{"printf", printf_builtin},
+		{"true", true_builtin},
+		{":", true_builtin},
+		{"test", test_builtin},
+		{"[", test_builtin},
+		{"time", time_builtin},
+		{"false", false_builtin},
+		{"pwd", pwd_builtin},
 		{"exit", exit_builtin},
 		{"env", env_builtin},
 		{"setenv", setenv_builtin},
 		{"unsetenv", unsetenv_builtin},
+		{"export", export_builtin},
+		{"unset", unset_builtin},
+		{"=", assign_builtin},
 		{"cd", cd_builtin},
 		{"alias", alias_builtin},
+		{"hash", hash_builtin},
+		{"memstats", memstats_builtin},
+		{"set", set_builtin},
+		{"jobs", jobs_builtin},
+		{"wait", wait_builtin},
+		{"fg", fg_builtin},
+		{"bg", bg_builtin},
 		{NULL, NULL}};
 
+	if (is_assignment(name))
+		name = "="; /* NAME=value words are run by assign_builtin */
 	for (i = 0; builtins[i].type; i++)
-		if (_strcmp(data->argv[0], builtins[i].type) == 0)
-		{
-			data->count++;
-			value = builtins[i].func(data);
-			break;
-		}
-	return (value);
+		if (_strcmp(name, builtins[i].type) == 0)
+			return (&builtins[i]);
+	return (NULL);
 }
 
 /**
@@ -0,0 +1,159 @@
+#include "shell.h"
+
+int glob_meta(char *, int);
+int glob_match(char *, char *);
+int glob_one(char **, char);
+int glob_class(char *, char, char **);
+int glob_compare(const void *, const void *);
+
+/**
+ * glob_meta - tells whether a pattern has a character that is special
+ *		to pathname expansion: '*', '?', or a '[' closed by a ']'.
+ * A character after a backslash is never special.
+ * @s: the pattern.
+ * @whole: non-zero to look at the whole word, zero to stop at a '/'.
+ * Return: 1 if there is one, 0 otherwise.
+ */
+int glob_meta(char *s, int whole)
+{
+	char *end;
+
+	for (; *s && (whole || *s != '/'); s++)
+	{
+		if (*s == '\\' && s[1])
+			s++;
+		else if (*s == '*' || *s == '?')
+			return (1);
+		else if (*s == '[')
+		{
+			glob_class(s, 0, &end);
+			if (end)
+				return (1);
+		}
+	}
+	return (0);
+}
+
+/**
+ * glob_match - matches a file name against one component of a pattern,
+ *		which ends at a '/' or at the end of the string.
+ * A '*' matches any characters: on a mismatch, the last one takes one
+ *		more, so the match never backtracks further than that.
+ * @pat: the component.
+ * @name: the file name.
+ * Return: 1 if the name matches, 0 otherwise.
+ */
+int glob_match(char *pat, char *name)
+{
+	char *star = NULL, *back = NULL;
+
+	while (*name)
+	{
+		if (*pat == '*')
+		{
+			star = ++pat;
+			back = name;
+			continue;
+		}
+		if (glob_one(&pat, *name))
+		{
+			name++;
+			continue;
+		}
+		if (!star)
+			return (0);
+		pat = star;
+		name = ++back;
+	}
+	while (*pat == '*')
+		pat++;
+	return (*pat == '\0' || *pat == '/');
+}
+
+/**
+ * glob_one - matches one character against the pattern element at the
+ *		start of a pattern: '?', a bracket expression, an escaped
+ *		character or a plain one.
+ * @pat: the pattern, moved past the element if it matches.
+ * @c: the character.
+ * Return: 1 if the character matches, 0 otherwise.
+ */
+int glob_one(char **pat, char c)
+{
+	char *p = *pat, *end;
+	int match;
+
+	if (!*p || *p == '/')
+		return (0);
+	if (*p == '?')
+	{
+		*pat = p + 1;
+		return (1);
+	}
+	if (*p == '[')
+	{
+		match = glob_class(p, c, &end);
+		if (end)
+		{
+			if (match)
+				*pat = end;
+			return (match);
+		}
+	}
+	if (*p == '\\' && p[1] && p[1] != '/')
+		p++;
+	if (*p != c)
+		return (0);
+	*pat = p + 1;
+	return (1);
+}
+
+/**
+ * glob_class - matches a character against a bracket expression:
+ *		a set of characters and ranges, negated by a leading '!' or
+ *		'^', where a ']' right after the '[' is one of them.
+ * @p: the '[' of the expression.
+ * @c: the character.
+ * @end: receives the character after the closing ']', or NULL if there
+ *		is none, in which case the '[' is an ordinary character.
+ * Return: 1 if the character is in the set, 0 otherwise.
+ */
+int glob_class(char *p, char c, char **end)
+{
+	int neg = 0, match = 0, first = 1;
+	unsigned char lo, hi;
+
+	p++;
+	if (*p == '!' || *p == '^')
+	{
+		neg = 1;
+		p++;
+	}
+	for (; *p && *p != '/' && (first || *p != ']'); first = 0)
+	{
+		if (*p == '\\' && p[1] && p[1] != '/')
+			p++;
+		lo = hi = *p++;
+		if (*p == '-' && p[1] && p[1] != ']' && p[1] != '/')
+		{
+			p++;
+			if (*p == '\\' && p[1] && p[1] != '/')
+				p++;
+			hi = *p++;
+		}
+		match |= (unsigned char)c >= lo && (unsigned char)c <= hi;
+	}
+	*end = *p == ']' ? p + 1 : NULL;
+	return (match != neg);
+}
+
+/**
+ * glob_compare - orders the matches of a pattern, for qsort().
+ * @a: a pointer to a match.
+ * @b: a pointer to another one.
+ * Return: the order of the two, as _strcmp() tells it.
+ */
+int glob_compare(const void *a, const void *b)
+{
+	return (_strcmp(*(char * const *)a, *(char * const *)b));
+}
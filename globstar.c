@@ -0,0 +1,68 @@
+#include "shell.h"
+
+int glob_star(shell_t *, strbuf_t *, char *, strvec_t *);
+int glob_keep(strvec_t *, strvec_t *);
+
+/**
+ * glob_star - matches a pattern whose next component is **, which
+ *		matches any number of directories: the tree under the
+ *		directory built so far is walked once, by several threads.
+ * "**" alone matches every name in the tree, and "**" followed by a '/'
+ *		every directory. When the rest is a single component, it is
+ *		matched by the walk itself; a longer rest is then matched under
+ *		each directory found, one after the other.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * @path: the directory so far, as in glob_walk().
+ * @rest: the pattern after the **.
+ * @out: the words of the command being built.
+ * Return: 0 on success, -1 if memory ran out.
+ */
+int glob_star(shell_t *data, strbuf_t *path, char *rest, strvec_t *out)
+{
+	strvec_t found = {NULL, 0, 0};
+	size_t i, len = path->len;
+	char *pat = NULL;
+	int result;
+
+	while (rest[0] == '/' && rest[1] == '*' && rest[2] == '*' &&
+			(!rest[3] || rest[3] == '/'))
+		rest += 3;
+	if (!rest[0])
+		pat = "";
+	else if (rest[1] && !_strchr(rest + 1, '/'))
+		pat = rest + 1;
+	if (walk_tree(data, path, pat, &found) == -1)
+		return (-1);
+	if (pat || !rest[1])
+		return (glob_keep(&found, out));
+	result = glob_walk(data, path, rest + 1, out);
+	for (i = 0; i < found.len && result != -1; i++)
+	{
+		path->len = 0;
+		result = strbuf_add(path, found.v[i], _strlen(found.v[i]) + 1);
+		path->len--;
+		if (result != -1)
+			result = glob_walk(data, path, rest + 1, out);
+	}
+	path->len = len;
+	strvec_free(&found);
+	return (result);
+}
+
+/**
+ * glob_keep - adds the paths a walk found to the command.
+ * @found: the paths, freed.
+ * @out: the words of the command being built.
+ * Return: 0 on success, -1 if memory ran out.
+ */
+int glob_keep(strvec_t *found, strvec_t *out)
+{
+	size_t i;
+	int result = 0;
+
+	for (i = 0; i < found->len && result != -1; i++)
+		result = strvec_push(out, found->v[i]);
+	strvec_free(found);
+	return (result);
+}
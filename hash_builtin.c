@@ -0,0 +1,86 @@
+#include "shell.h"
+
+int hash_builtin(shell_t *);
+int print_hash(shell_t *, int);
+
+/**
+ * hash_builtin - implements the functionality of the hash command.
+ *		It lists, adds and clears the remembered command locations.
+ *	hash		lists the remembered commands and their hits
+ *	hash -r		forgets every command
+ *	hash -s		prints the table's hit and miss counters
+ *	hash NAME...	looks up each NAME in PATH and remembers it
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * Return: 0 on success, 1 if a command was not found.
+ */
+int hash_builtin(shell_t *data)
+{
+	char *pathstr = _getenv(data, "PATH=");
+	int i, value = 0;
+
+	if (data->argc == 1)
+		return (print_hash(data, 0));
+	for (i = 1; data->argv[i]; i++)
+	{
+		if (!_strcmp(data->argv[i], "-r"))
+		{
+			if (data->hash)
+				hash_flush(data->hash, 1);
+			if (data->hash)
+				data->hash->hits = data->hash->misses = 0;
+		}
+		else if (!_strcmp(data->argv[i], "-s"))
+			print_hash(data, 1);
+		else if (!pathstr || !hash_lookup(data, pathstr, data->argv[i]))
+		{
+			_perror(data, data->argv[i]);
+			_eputs(": not found\n");
+			value = 1;
+		}
+	}
+	return (value);
+}
+
+/**
+ * print_hash - prints the remembered commands, or the table's counters.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * @stats: true to print the hit and miss counters instead.
+ * Return: 0 on success.
+ */
+int print_hash(shell_t *data, int stats)
+{
+	cmdtable_t *t = data->hash;
+	cmdhash_t *entry;
+	char *hits;
+	int i, found = 0;
+
+	if (stats)
+	{
+		_puts("hits: ");
+		_puts(_itoa(t ? t->hits : 0, 10, 0));
+		_puts(", misses: ");
+		_puts(_itoa(t ? t->misses : 0, 10, 0));
+		_putchar('\n');
+		return (0);
+	}
+	for (i = 0; t && i < CMD_HASH_SIZE; i++)
+		for (entry = t->buckets[i]; entry; entry = entry->next)
+		{
+			if (!entry->path)
+				continue;
+			if (!found++)
+				_puts("hits\tcommand\n");
+			hits = _itoa(entry->hits, 10, 0);
+			for (found = _strlen(hits); found < 4; found++)
+				_putchar(' ');
+			_puts(hits);
+			_putchar('\t');
+			_puts(entry->path);
+			_putchar('\n');
+		}
+	if (!found)
+		_puts("hash: hash table empty\n");
+	return (0);
+}
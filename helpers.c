@@ -14,20 +14,42 @@ int isdelimeter(char, char *);
  */
 void free_data(shell_t *data, int all)
 {
-	_free(data->argv);
+	arena_reset(&data->arena);
+	data->args.len = 0;
+	data->cmdno++; /* no word points into a listing any more */
 	data->argv = NULL;
 	data->path = NULL;
+	free_retired(data);
 	if (all)
 	{
-		if (!data->Buffer)
-			free(data->arg);
-		if (data->env)
-			free_list(&(data->env));
-		if (data->alias)
-			free_list(&(data->alias));
-		_free(data->environ);
-		data->environ = NULL;
-		_free2((void **)data->Buffer);
+		strvec_free(&data->args);
+		strvec_free(&data->globs);
+		free(data->globpath.s);
+		arena_free(&data->arena);
+		free(data->scratch.s);
+		data->scratch.s = NULL;
+		data->scratch.cap = 0;
+		free_parse_cache(data);
+		if (data->hash)
+			hash_flush(data->hash, 1);
+		free(data->hash);
+		data->hash = NULL;
+		free_stat_cache(data);
+		free_dir_cache(data);
+		zygote_stop(data);
+		while (data->jobs)
+			job_free(data, data->jobs);
+		if (data->spare)
+			free(data->spare->procs), free(data->spare->text);
+		free(data->spare);
+		free_done(data);
+		env_free(&data->env);
+		env_free(&data->vars);
+		free_aliases(data);
+		if (data->Buffer)
+			release_line(data, data->Buffer);
+		unmap_script(data);
+		free_reader(&data->in);
 		if (data->file_descriptor > 2)
 			close(data->file_descriptor);
 		_putchar(BUF_FLUSH);
@@ -62,34 +84,18 @@ void _perror(shell_t *data, char *str)
  */
 int decimal(int input, int fd)
 {
-	int (*__putchar)(char) = _putchar;
-	int i, count = 0;
-	unsigned int _abs_, current;
+	char digits[12], *p = digits + sizeof(digits);
+	unsigned int _abs_ = input < 0 ? -(unsigned int)input : (unsigned int)input;
 
-	if (fd == STDERR_FILENO)
-		__putchar = _puts2;
+	do {
+		*--p = '0' + _abs_ % 10;
+		_abs_ /= 10;
+	} while (_abs_);
 	if (input < 0)
-	{
-		_abs_ = -input;
-		__putchar('-');
-		count++;
-	}
-	else
-		_abs_ = input;
-	current = _abs_;
-	for (i = 1000000000; i > 1; i /= 10)
-	{
-		if (_abs_ / i)
-		{
-			__putchar('0' + current / i);
-			count++;
-		}
-		current %= i;
-	}
-	__putchar('0' + current);
-	count++;
-
-	return (count);
+		*--p = '-';
+	out_write(fd == STDERR_FILENO ? STDERR_FILENO : STDOUT_FILENO,
+			p, digits + sizeof(digits) - p);
+	return (digits + sizeof(digits) - p);
 }
 
 /**
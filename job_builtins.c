@@ -0,0 +1,124 @@
+#include "shell.h"
+
+int jobs_builtin(shell_t *);
+int wait_builtin(shell_t *);
+int wait_all(shell_t *, int);
+int wait_one(shell_t *, char *);
+
+/**
+ * jobs_builtin - implements the functionality of the jobs command.
+ *		It lists the jobs, then forgets the finished ones.
+ *	jobs		lists the jobs and their state
+ *	jobs -l		also lists the pid of each process
+ *	jobs -p		only lists each job's process group
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * Return: 0 on success.
+ */
+int jobs_builtin(shell_t *data)
+{
+	job_t *job, *next;
+	int mode = 0;
+
+	if (data->argv[1] && !_strcmp(data->argv[1], "-l"))
+		mode = 1;
+	else if (data->argv[1] && !_strcmp(data->argv[1], "-p"))
+		mode = 2;
+	reap_jobs(data);
+	for (job = data->jobs; job; job = next)
+	{
+		next = job->next;
+		job->notify = 0;
+		print_job(data, job, mode);
+		if (job_state(job) == PROC_DONE)
+			job_free(data, job);
+	}
+	data->status = 0;
+	return (0);
+}
+
+/**
+ * wait_builtin - implements the functionality of the wait command.
+ *	wait		waits for every job, the status is 0
+ *	wait -n		waits for the next job to finish, and takes its status
+ *	wait ID...	waits for each job, given as %n or as a pid,
+ *			and takes the status of the last one
+ * A job waited for is forgotten, as are, after wait alone, the finished
+ *		jobs a script remembers; an unknown one gives the status 127.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * Return: the status.
+ */
+int wait_builtin(shell_t *data)
+{
+	int i;
+
+	if (!data->argv[1])
+		return (wait_all(data, 0));
+	if (!_strcmp(data->argv[1], "-n"))
+		return (wait_all(data, 1));
+	for (i = 1; data->argv[i]; i++)
+		wait_one(data, data->argv[i]);
+	return (data->status);
+}
+
+/**
+ * wait_all - waits for every job, or for the next one to finish.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * @any: non-zero to only wait for the next job to finish, which may
+ *		be one a script remembers as finished already.
+ * Return: the status: 0 after every job, the job's status after the
+ *		next one, or 127 if no job was left to finish.
+ */
+int wait_all(shell_t *data, int any)
+{
+	job_t *job, *next;
+	int status = any ? job_recall(data, NULL) : -1;
+
+	if (status != -1)
+		return (data->status = status);
+	job = wait_jobs(data, NULL, any);
+	data->status = 0;
+	if (any)
+	{
+		data->status = job ? job_status(data, job) : 127;
+		if (job)
+			job_free(data, job);
+		return (data->status);
+	}
+	free_done(data);
+	for (job = data->jobs; job; job = next)
+	{
+		next = job->next;
+		if (job_state(job) == PROC_DONE)
+			job_free(data, job);
+	}
+	return (0);
+}
+
+/**
+ * wait_one - waits for one job and takes its status.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * A job no longer in the table may be one a script remembers.
+ * @spec: the job, as %n or as the pid of one of its processes.
+ * Return: the status, 127 if there is no such job.
+ */
+int wait_one(shell_t *data, char *spec)
+{
+	job_t *job = find_job(data, spec);
+	int status;
+
+	if (!job)
+	{
+		status = job_recall(data, spec);
+		return (data->status = status == -1 ? 127 : status);
+	}
+	wait_jobs(data, job, 0);
+	if (job_state(job) == PROC_STOPPED)
+		return (data->status = 128 + SIGTSTP);
+	data->status = job_status(data, job);
+	job_free(data, job);
+	return (data->status);
+}
@@ -0,0 +1,165 @@
+#include "shell.h"
+
+void init_job_control(shell_t *);
+void job_launch(shell_t *, job_t *, launch_t *, int);
+void job_started(shell_t *, job_t *, int, pid_t);
+int job_finish(shell_t *, job_t *, int);
+int wait_job(shell_t *, job_t *);
+
+/**
+ * init_job_control - installs the SIGCHLD handler that lets finished
+ *		background jobs be reaped, and in an interactive shell turns
+ *		job control on: the shell takes its own process group and
+ *		the terminal, and ignores the terminal's stop signals.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ */
+void init_job_control(shell_t *data)
+{
+	struct sigaction sa;
+	pid_t fg;
+
+	memset(&sa, 0, sizeof(sa));
+	sa.sa_handler = sigchld_handler;
+	sa.sa_flags = SA_RESTART;
+	sigemptyset(&sa.sa_mask);
+	sigaction(SIGCHLD, &sa, NULL);
+	data->pgid = getpgrp();
+	if (!interactive(data))
+		return;
+	/* started in the background: wait to be brought to the foreground */
+	while ((fg = tcgetpgrp(STDIN_FILENO)) != -1 &&
+			fg != (data->pgid = getpgrp()))
+		kill(-data->pgid, SIGTTIN);
+	signal(SIGTSTP, SIG_IGN);
+	signal(SIGTTIN, SIG_IGN);
+	signal(SIGTTOU, SIG_IGN);
+	signal(SIGQUIT, SIG_IGN);
+	if (setpgid(0, 0) == -1 && errno != EPERM) /* EPERM: a session leader */
+		return;
+	data->pgid = getpgrp();
+	if (tcsetpgrp(STDIN_FILENO, data->pgid) == 0)
+		data->jobctl = 1;
+}
+
+/**
+ * job_launch - prepares the launch of one of a job's processes:
+ *		with job control on, the job gets its own process group,
+ *		led by its first process, and a foreground job the terminal.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * @job: the job.
+ * @launch: receives the process's launch, inheriting every descriptor
+ *		the command does not redirect.
+ * @fg: non-zero for a foreground job.
+ */
+void job_launch(shell_t *data, job_t *job, launch_t *launch, int fg)
+{
+	launch_init(launch);
+	launch->pgid = data->jobctl ? job->pgid : -1;
+	launch->tty = data->jobctl && fg ? STDIN_FILENO : -1;
+	if (data->redir)
+		memcpy(launch->fd, data->redir->fd, sizeof(launch->fd));
+}
+
+/**
+ * job_started - records a process of a job once it was started.
+ * The shell also moves the process to the job's process group,
+ *		so that the group exists whichever of them runs first.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * @job: the job.
+ * @i: the process's position in the job.
+ * @pid: the process's pid, or -1 with the status set if it did not start.
+ */
+void job_started(shell_t *data, job_t *job, int i, pid_t pid)
+{
+	job->procs[i].pid = pid;
+	job->procs[i].state = pid == -1 ? PROC_DONE : PROC_RUNNING;
+	job->procs[i].status = data->status;
+	if (pid == -1 || !data->jobctl)
+		return;
+	if (!job->pgid)
+		job->pgid = pid;
+	setpgid(pid, job->pgid);
+}
+
+/**
+ * job_finish - waits for a foreground job, or reports the start of a
+ *		background one, which leaves the status at 0 and sets $!.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * @job: the job, all of its processes started.
+ * @async: non-zero for a background job.
+ * Return: 0.
+ */
+int job_finish(shell_t *data, job_t *job, int async)
+{
+	int i;
+
+	if (!async)
+		return (wait_job(data, job));
+	for (i = 0; i < job->n; i++)
+		if (job->procs[i].pid != -1)
+			data->last_bg = job->procs[i].pid;
+	if (interactive(data))
+	{
+		_eputs("[");
+		decimal(job->id, STDERR_FILENO);
+		_eputs("] ");
+		decimal(data->last_bg, STDERR_FILENO);
+		_eputs("\n");
+		_puts2(BUF_FLUSH);
+	}
+	data->status = 0;
+	return (0);
+}
+
+/**
+ * wait_job - waits for a foreground job to finish or to be stopped,
+ *		then takes the terminal back. A finished job leaves the
+ *		table, its usage charged to the running command; a stopped
+ *		one stays, to be resumed with fg or bg.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * @job: the job.
+ * Return: 0.
+ */
+int wait_job(shell_t *data, job_t *job)
+{
+	int i, status;
+	pid_t pid;
+	struct rusage ru;
+
+	_putchar(BUF_FLUSH); /* the output goes out before the shell blocks */
+	if (data->jobctl && job->pgid)
+		tcsetpgrp(STDIN_FILENO, job->pgid);
+	for (i = 0; i < job->n; i++)
+	{
+		if (job->procs[i].state == PROC_DONE)
+			continue;
+		do {
+			pid = wait4(job->procs[i].pid, &status, WUNTRACED, &ru);
+		} while (pid == -1 && errno == EINTR);
+		if (pid == -1)
+			job->procs[i].state = PROC_DONE;
+		else
+			proc_update(job, &job->procs[i], status, &ru);
+	}
+	if (data->jobctl)
+		tcsetpgrp(STDIN_FILENO, data->pgid);
+	if (job_state(job) == PROC_STOPPED)
+	{
+		_puts("\n");
+		print_job(data, job, 0);
+		data->status = 128 + SIGTSTP;
+		return (0);
+	}
+	data->status = job_status(data, job);
+	if (data->jobctl && data->status == 128 + SIGINT)
+		_puts("\n"); /* the terminal echoed ^C */
+	if (data->acct)
+		usage_add(&data->acct->ru, &job->ru);
+	job_free(data, job);
+	return (0);
+}
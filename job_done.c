@@ -0,0 +1,95 @@
+#include "shell.h"
+
+void job_retire(shell_t *, job_t *);
+int job_recall(shell_t *, char *);
+int job_done_id(shell_t *);
+void free_done(shell_t *);
+
+/**
+ * job_retire - takes a finished job of a script out of the job table,
+ *		remembering its status for wait.
+ * Past JOBS_DONE_MAX, the oldest status is forgotten, or, if memory
+ *		ran out, this one.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * @job: the job, done.
+ */
+void job_retire(shell_t *data, job_t *job)
+{
+	done_t *d;
+	int i;
+
+	if (!data->done)
+		data->done = malloc(sizeof(done_t) * JOBS_DONE_MAX);
+	if (data->done)
+	{
+		if (data->ndone == JOBS_DONE_MAX)
+			memmove(data->done, data->done + 1,
+					sizeof(done_t) * --data->ndone);
+		d = &data->done[data->ndone++];
+		d->pid = job->procs[job->n - 1].pid;
+		d->id = job->id;
+		d->status = job->procs[job->n - 1].status;
+		for (i = job->n - 1; i > 0 && !job->procs[i].status; i--)
+			;
+		d->failed = job->procs[i].status;
+	}
+	job_free(data, job);
+}
+
+/**
+ * job_recall - takes the status of a finished job that left the job
+ *		table, which is then forgotten.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * @spec: the job, as %n or as the pid of its last process, NULL for the
+ *		one that finished first.
+ * Return: its status, or -1 if no such job is remembered.
+ */
+int job_recall(shell_t *data, char *spec)
+{
+	int i = spec ? data->ndone - 1 : 0, n = 0, status;
+	done_t *d;
+
+	if (spec)
+		n = _atoi(spec + (*spec == '%'));
+	for (; i >= 0 && i < data->ndone && (!spec || n > 0); i--)
+	{
+		d = &data->done[i];
+		if (spec && (*spec == '%' ? d->id != n : d->pid != n))
+			continue;
+		status = data->options & OPT_PIPEFAIL ? d->failed : d->status;
+		memmove(d, d + 1, sizeof(done_t) * (--data->ndone - i));
+		return (status);
+	}
+	return (-1);
+}
+
+/**
+ * job_done_id - finds the highest number of a remembered job, which a
+ *		new job is numbered past, as it still answers to it.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * Return: the number, 0 if no job is remembered.
+ */
+int job_done_id(shell_t *data)
+{
+	int i, id = 0;
+
+	for (i = 0; i < data->ndone; i++)
+		if (data->done[i].id > id)
+			id = data->done[i].id;
+	return (id);
+}
+
+/**
+ * free_done - forgets the finished jobs of a script.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ */
+void free_done(shell_t *data)
+{
+	free(data->done);
+	data->done = NULL;
+	data->ndone = 0;
+}
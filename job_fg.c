@@ -0,0 +1,147 @@
+#include "shell.h"
+
+int fg_builtin(shell_t *);
+int bg_builtin(shell_t *);
+job_t *control_job(shell_t *);
+void print_job(shell_t *, job_t *, int);
+int jobs_running(shell_t *);
+
+/**
+ * fg_builtin - implements the functionality of the fg command:
+ *		it resumes a job in the foreground and waits for it.
+ *	fg [%n]		the current job when none is given
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * Return: the job's status, 1 if it could not be resumed.
+ */
+int fg_builtin(shell_t *data)
+{
+	job_t *job = control_job(data);
+	int i;
+
+	if (!job)
+		return (data->status);
+	_puts(job->text ? job->text : "");
+	_puts("\n");
+	_putchar(BUF_FLUSH);
+	for (i = 0; i < job->n; i++)
+		if (job->procs[i].state == PROC_STOPPED)
+			job->procs[i].state = PROC_RUNNING;
+	kill(-job->pgid, SIGCONT);
+	wait_job(data, job);
+	return (data->status);
+}
+
+/**
+ * bg_builtin - implements the functionality of the bg command:
+ *		it resumes a stopped job in the background.
+ *	bg [%n]		the current job when none is given
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * Return: 0 on success, 1 if the job could not be resumed.
+ */
+int bg_builtin(shell_t *data)
+{
+	job_t *job = control_job(data);
+	int i;
+
+	if (!job)
+		return (data->status);
+	for (i = 0; i < job->n; i++)
+		if (job->procs[i].state == PROC_STOPPED)
+			job->procs[i].state = PROC_RUNNING;
+	kill(-job->pgid, SIGCONT);
+	_puts("[");
+	_puts(_itoa(job->id, 10, 0));
+	_puts("] ");
+	_puts(job->text ? job->text : "");
+	_puts(" &\n");
+	data->status = 0;
+	return (0);
+}
+
+/**
+ * control_job - finds the job fg or bg was given, which must have
+ *		a process group of its own.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * Return: the job, or NULL with the status set to 1.
+ */
+job_t *control_job(shell_t *data)
+{
+	job_t *job;
+
+	data->status = 1;
+	if (!data->jobctl)
+	{
+		_perror(data, "no job control\n");
+		return (NULL);
+	}
+	reap_jobs(data);
+	job = find_job(data, data->argv[1]);
+	if (!job || !job->pgid || job_state(job) == PROC_DONE)
+	{
+		_perror(data, "no such job\n");
+		return (NULL);
+	}
+	return (job);
+}
+
+/**
+ * print_job - prints a job the way the jobs command lists it:
+ *		its number, + for the current job and - for the previous
+ *		one, its state and its command line.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * @job: the job.
+ * @mode: 1 to also print the pid of each process,
+ *		2 to print nothing but the job's process group.
+ */
+void print_job(shell_t *data, job_t *job, int mode)
+{
+	int i, state = job_state(job), status = job_status(data, job);
+	char label[32];
+
+	if (mode == 2)
+	{
+		_puts(_itoa(job->pgid ? job->pgid : job->procs[0].pid, 10, 0));
+		_puts("\n");
+		return;
+	}
+	_puts("[");
+	_puts(_itoa(job->id, 10, 0));
+	_puts(job == find_job(data, NULL) ? "]+ " :
+			job == find_job(data, "%-") ? "]- " : "]  ");
+	for (i = 0; mode == 1 && i < job->n; i++)
+	{
+		_puts(_itoa(job->procs[i].pid, 10, 0));
+		_puts(" ");
+	}
+	_strcpy(label, state == PROC_RUNNING ? "Running" : "Stopped");
+	if (state == PROC_DONE)
+		_strcpy(label, status ? "Exit " : "Done");
+	if (state == PROC_DONE && status)
+		_strcat(label, _itoa(status, 10, 0));
+	_puts(label);
+	for (i = _strlen(label); i < 24; i++)
+		_puts(" ");
+	_puts(job->text ? job->text : "");
+	_puts("\n");
+}
+
+/**
+ * jobs_running - tells whether a background job may still be running,
+ *		as far as the last reap_jobs() knows.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * Return: 1 if a job is running, 0 if they are all stopped or done.
+ */
+int jobs_running(shell_t *data)
+{
+	job_t *job;
+
+	for (job = data->jobs; job; job = job->next)
+		if (job_state(job) == PROC_RUNNING)
+			return (1);
+	return (0);
+}
@@ -0,0 +1,147 @@
+#include "shell.h"
+
+void sigchld_handler(int);
+void reap_jobs(shell_t *);
+void proc_update(job_t *, proc_t *, int, struct rusage *);
+job_t *wait_jobs(shell_t *, job_t *, int);
+void notify_jobs(shell_t *);
+
+static volatile sig_atomic_t children_changed;
+
+/**
+ * sigchld_handler - a signal handler for the SIGCHLD signal: it only
+ *		records that a child changed state, reap_jobs() does the rest.
+ * @sig_num: the signal number
+ */
+void sigchld_handler(__attribute__((unused)) int sig_num)
+{
+	children_changed = 1;
+}
+
+/**
+ * reap_jobs - collects, without blocking, the state changes of the
+ *		processes of the job table since the last SIGCHLD.
+ * Each process is waited for by pid, so children that are not jobs
+ *		are left alone, with wait4() so that what it used is known.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ */
+void reap_jobs(shell_t *data)
+{
+	job_t *job;
+	int i, status;
+	struct rusage ru;
+
+	if (!children_changed)
+		return;
+	children_changed = 0;
+	for (job = data->jobs; job; job = job->next)
+		for (i = 0; i < job->n; i++)
+		{
+			if (job->procs[i].state == PROC_DONE)
+				continue;
+			if (wait4(job->procs[i].pid, &status, WNOHANG |
+					WUNTRACED | WCONTINUED, &ru) > 0)
+			{
+				proc_update(job, &job->procs[i], status, &ru);
+				job->notify = 1;
+			}
+		}
+}
+
+/**
+ * proc_update - records a state change reported by wait4(), adding what
+ *		a process that is done used to its job.
+ * @job: the job of the process.
+ * @proc: the process.
+ * @status: the status reported by wait4().
+ * @ru: the resources reported by wait4().
+ */
+void proc_update(job_t *job, proc_t *proc, int status, struct rusage *ru)
+{
+	if (WIFSTOPPED(status))
+		proc->state = PROC_STOPPED;
+	else if (WIFCONTINUED(status))
+		proc->state = PROC_RUNNING;
+	else
+	{
+		proc->state = PROC_DONE;
+		proc->status = child_status(status);
+		usage_add(&job->ru, ru);
+	}
+}
+
+/**
+ * wait_jobs - waits for background jobs to stop running, sleeping in
+ *		sigsuspend() between two SIGCHLD signals.
+ * SIGCHLD is blocked while the job table is checked, so a child that
+ *		changes state in between still wakes the shell up.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * @job: the job to wait for, NULL for every job.
+ * @any: with a NULL job, wait for the first job to finish instead.
+ * Return: with any, the finished job or NULL if no job is left running;
+ *		otherwise NULL.
+ */
+job_t *wait_jobs(shell_t *data, job_t *job, int any)
+{
+	sigset_t set, old;
+	job_t *j, *done;
+	int running;
+
+	sigemptyset(&set);
+	sigaddset(&set, SIGCHLD);
+	sigprocmask(SIG_BLOCK, &set, &old);
+	while (1)
+	{
+		reap_jobs(data);
+		done = NULL;
+		running = 0;
+		for (j = data->jobs; j; j = j->next)
+		{
+			if (job && j != job)
+				continue;
+			if (job_state(j) == PROC_RUNNING)
+				running = 1;
+			else if (any && !done && job_state(j) == PROC_DONE)
+				done = j;
+		}
+		if (done || !running)
+			break;
+		sigsuspend(&old);
+	}
+	sigprocmask(SIG_SETMASK, &old, NULL);
+	return (done);
+}
+
+/**
+ * notify_jobs - reports the jobs that finished or stopped since the
+ *		last prompt, and forgets the finished ones.
+ * A script reports nothing and takes the finished jobs out of the
+ *		table as it goes, keeping only their status for wait.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ */
+void notify_jobs(shell_t *data)
+{
+	job_t *job, *next;
+	int tell = interactive(data);
+
+	reap_jobs(data);
+	for (job = data->jobs; job; job = next)
+	{
+		next = job->next;
+		if (!tell)
+		{
+			if (job_state(job) == PROC_DONE)
+				job_retire(data, job);
+			continue;
+		}
+		if (!job->notify)
+			continue;
+		job->notify = 0;
+		print_job(data, job, 0);
+		if (job_state(job) == PROC_DONE)
+			job_free(data, job);
+	}
+}
@@ -0,0 +1,182 @@
+#include "shell.h"
+
+job_t *job_new(shell_t *, int);
+int job_text(job_t *, char **);
+void job_free(shell_t *, job_t *);
+job_t *find_job(shell_t *, char *);
+int job_state(job_t *);
+
+/**
+ * job_new - adds a job to the end of the job table,
+ *		numbered one past the highest job number in use, or
+ *		remembered for wait.
+ * The spare job is taken if it has room for the processes.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * @n: the number of processes of the job.
+ * Return: the new job, or NULL if memory ran out.
+ */
+job_t *job_new(shell_t *data, int n)
+{
+	job_t *job = data->spare, **last = &data->jobs;
+	int i;
+
+	if (job && job->cap >= n)
+		data->spare = NULL;
+	else
+	{
+		job = calloc(1, sizeof(job_t));
+		if (job)
+			job->procs = malloc(sizeof(proc_t) * n);
+		if (!job || !job->procs)
+			return (free(job), NULL);
+		job->cap = n;
+	}
+	job->n = n;
+	job->id = job_done_id(data) + 1;
+	for (i = 0; i < n; i++)
+	{
+		job->procs[i].pid = -1;
+		job->procs[i].state = PROC_DONE;
+		job->procs[i].status = 0;
+	}
+	for (; *last; last = &(*last)->next)
+		if ((*last)->id >= job->id)
+			job->id = (*last)->id + 1;
+	*last = job;
+	return (job);
+}
+
+/**
+ * job_text - appends a command to the command line of a job,
+ *		after a "|" when the job already has one.
+ * @job: the job.
+ * @words: the command's words, terminated by a NULL.
+ * Return: 0 on success, -1 if memory ran out.
+ */
+int job_text(job_t *job, char **words)
+{
+	int i, n, used = _strlen(job->text), len = used ? used + 3 : 0;
+	char *text, *end;
+
+	for (i = 0; words[i]; i++)
+		len += _strlen(words[i]) + 1;
+	if ((size_t)len + 1 > job->textcap)
+	{
+		text = realloc(job->text, len + 1);
+		if (!text)
+			return (-1);
+		job->text = text;
+		job->textcap = len + 1;
+	}
+	end = job->text + used;
+	if (used)
+	{
+		memcpy(end, " | ", 3);
+		end += 3;
+	}
+	for (i = 0; words[i]; i++)
+	{
+		n = _strlen(words[i]);
+		memcpy(end, words[i], n);
+		end += n;
+		if (words[i + 1])
+			*end++ = ' ';
+	}
+	*end = '\0';
+	return (0);
+}
+
+/**
+ * job_free - removes a job from the job table and frees it, or keeps it
+ *		as the spare job if it has room for more processes than the
+ *		spare, so that the next job needs no allocation.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * @job: the job.
+ */
+void job_free(shell_t *data, job_t *job)
+{
+	job_t **p, *spare;
+
+	for (p = &data->jobs; *p; p = &(*p)->next)
+		if (*p == job)
+		{
+			*p = job->next;
+			break;
+		}
+	if (!data->spare || data->spare->cap <= job->cap)
+	{
+		spare = data->spare;
+		data->spare = job;
+		job->next = NULL;
+		job->pgid = 0;
+		job->notify = 0;
+		memset(&job->ru, 0, sizeof(job->ru));
+		if (job->text)
+			*job->text = '\0';
+		job = spare;
+		if (!job)
+			return;
+	}
+	free(job->procs);
+	free(job->text);
+	free(job);
+}
+
+/**
+ * find_job - finds a job from the way the user refers to it:
+ *		%n for job number n, %% or %+ for the current job,
+ *		%- for the previous one, or the pid of one of its processes.
+ * The current job is the last one started.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * @spec: the job's designation, NULL for the current job.
+ * Return: the job, or NULL if there is no such job.
+ */
+job_t *find_job(shell_t *data, char *spec)
+{
+	job_t *job, *prev = NULL, *cur = NULL;
+	int i, n = -1;
+
+	for (job = data->jobs; job; job = job->next)
+	{
+		prev = cur;
+		cur = job;
+	}
+	if (!spec || !_strcmp(spec, "%%") || !_strcmp(spec, "%+"))
+		return (cur);
+	if (!_strcmp(spec, "%-"))
+		return (prev);
+	n = _atoi(spec + (*spec == '%'));
+	for (job = data->jobs; job && n > 0; job = job->next)
+	{
+		if (*spec == '%' && job->id == n)
+			return (job);
+		for (i = 0; *spec != '%' && i < job->n; i++)
+			if (job->procs[i].pid == n)
+				return (job);
+	}
+	return (NULL);
+}
+
+/**
+ * job_state - tells whether a job is running, stopped or done.
+ * A job is running while one of its processes runs, and stopped
+ *		when the processes left are all stopped.
+ * @job: the job.
+ * Return: PROC_RUNNING, PROC_STOPPED or PROC_DONE.
+ */
+int job_state(job_t *job)
+{
+	int i, state = PROC_DONE;
+
+	for (i = 0; i < job->n; i++)
+	{
+		if (job->procs[i].state == PROC_RUNNING)
+			return (PROC_RUNNING);
+		if (job->procs[i].state == PROC_STOPPED)
+			state = PROC_STOPPED;
+	}
+	return (state);
+}
@@ -18,6 +18,8 @@ int main(int argc, char **argv)
 	shell_t data[] = {SHELL_INIT};
 	int fd = 2;
 
+	mem_init();
+	str_init();
 	fd += 3;
 	/* Check if the program is executed with a command-line argument */
 	if (argc == 2)
@@ -49,10 +51,17 @@ int main(int argc, char **argv)
 		 * to the opened file descriptor
 		 */
 		data->file_descriptor = fd;
+		/* Serve script lines straight from a mapping when it is a regular file */
+		map_script(data);
 	}
 
 	/* Populate the shell_t structure with environment variables */
 	populate(data);
+	/* Reap background jobs, and take the terminal when interactive */
+	init_job_control(data);
+	/* Fork the zygote while the shell is small, if it is to be used */
+	if (spawn_backend(data) == SPAWN_ZYGOTE)
+		zygote_start(data);
 
 	/**
 	 * Execute the shell program with
@@ -64,29 +73,28 @@ int main(int argc, char **argv)
 }
 
 /**
- * populate - populates env linked list.
+ * populate - populates the env hash table.
  * initializes the shell_t structure's env field with environment variables.
- *	and creating a linked list of environment variables
  *		by iterating through the environ array
- * and appending each environment variable to the linked list.
+ * and setting each environment variable in the table, in order.
  * @data:  A pointer to the shell data structure,
  *		which contains information about the current state of the shell.
- * Return: returns 0 to indicate success.
+ * Return: returns 0 to indicate success, -1 if memory ran out.
  */
 int populate(shell_t *data)
 {
-	list_t *node = NULL;
 	size_t i;
+	char *string;
 
-	/* Iterate through the environ array */
+	/* Copy the environ array into the environment table */
 	for (i = 0; environ[i]; i++)
-		append_node(&node, environ[i], 0);
-
-	/**
-	 * Assign the linked list of environment variables
-	 * to the shell structure's env field
-	 */
-	data->env = node;
+	{
+		if (!_strchr(environ[i], '='))
+			continue;
+		string = _strdup(environ[i]);
+		if (!string || env_put(&data->env, string) == -1)
+			return (-1);
+	}
 
 	return (0);
 }
@@ -123,8 +131,7 @@ ssize_t input_buffer(shell_t *data, char **buffer, size_t *len)
 
 	if (!*len) /* if nothing left in the buffer, fill it */
 	{
-		free(*buffer);
-		*buffer = NULL;
+		release_line(data, buffer);
 		signal(SIGINT, sigintHandler);
 /* 1 if using system getline() */
 #define USED_GETLINE 0
@@ -141,7 +148,7 @@ ssize_t input_buffer(shell_t *data, char **buffer, size_t *len)
 				/* remove trailing newline */
 				read--;
 			}
-			data->display = 1;
+			data->count++; /* line number used in error messages */
 			remove_comments(*buffer);
 			{
 				*len = read;
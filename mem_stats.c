@@ -0,0 +1,113 @@
+#include "shell.h"
+#undef malloc
+#undef calloc
+#undef realloc
+#undef free
+
+void mem_init(void);
+void *mem_malloc(size_t, const char *);
+void *mem_calloc(size_t, size_t, const char *);
+void *mem_realloc(void *, size_t, const char *);
+void mem_free(void *);
+
+/**
+ * mem_init - starts keeping the allocation statistics if HSH_MEMSTATS is
+ *		set to something other than 0, and has them reported at exit.
+ * It runs first thing, so that no allocation goes uncounted: the variable
+ *		is read from the environment the shell was started with.
+ */
+void mem_init(void)
+{
+	char *s = getenv("HSH_MEMSTATS");
+
+	if (!s || !*s || !_strcmp(s, "0"))
+		return;
+	pthread_mutex_init(&mem_stats.lock, NULL);
+	mem_stats.pid = getpid();
+	mem_stats.sites[MEM_SITES].site = "(other sites)";
+	mem_stats.on = 1;
+	atexit(mem_report);
+}
+
+/**
+ * mem_malloc - allocates memory, counted against a call site.
+ * @n: the number of bytes.
+ * @site: the call site.
+ * Return: the memory, or NULL if it ran out.
+ */
+void *mem_malloc(size_t n, const char *site)
+{
+	void *p = malloc(n);
+
+	if (!mem_stats.on)
+		return (p);
+	pthread_mutex_lock(&mem_stats.lock);
+	mem_track(p, n, site);
+	pthread_mutex_unlock(&mem_stats.lock);
+	return (p);
+}
+
+/**
+ * mem_calloc - allocates an array set to zero, counted against a call site.
+ * @n: the number of elements.
+ * @size: the size of an element.
+ * @site: the call site.
+ * Return: the memory, or NULL if it ran out.
+ */
+void *mem_calloc(size_t n, size_t size, const char *site)
+{
+	void *p = calloc(n, size);
+
+	if (!mem_stats.on)
+		return (p);
+	pthread_mutex_lock(&mem_stats.lock);
+	mem_track(p, n * size, site);
+	pthread_mutex_unlock(&mem_stats.lock);
+	return (p);
+}
+
+/**
+ * mem_realloc - resizes memory, the new object being counted against
+ *		a call site, and the old one no longer counted as live.
+ * The old object's slot is found before realloc() and forgotten only
+ *		if realloc() gave the memory back. The lock is held over the
+ *		call, so that no other thread is handed the old address
+ *		before it is forgotten.
+ * @p: the memory, or NULL.
+ * @n: the new number of bytes.
+ * @site: the call site.
+ * Return: the memory, or NULL if it ran out, p being left as it was.
+ */
+void *mem_realloc(void *p, size_t n, const char *site)
+{
+	memobj_t *o, *put;
+	void *q;
+
+	if (!mem_stats.on)
+		return (realloc(p, n));
+	pthread_mutex_lock(&mem_stats.lock);
+	o = mem_slot(p, &put);
+	q = realloc(p, n);
+	if (q || !n)
+		mem_untrack(o);
+	mem_track(q, n, site);
+	pthread_mutex_unlock(&mem_stats.lock);
+	return (q);
+}
+
+/**
+ * mem_free - frees memory, no longer counted as live.
+ * @p: the memory, or NULL.
+ */
+void mem_free(void *p)
+{
+	memobj_t *put;
+
+	if (mem_stats.on && p)
+	{
+		pthread_mutex_lock(&mem_stats.lock);
+		mem_untrack(mem_slot(p, &put));
+		pthread_mutex_unlock(&mem_stats.lock);
+	}
+	free(p);
+}
@@ -0,0 +1,151 @@
+#include "shell.h"
+#undef calloc
+#undef free
+
+memstats_t mem_stats;
+
+memsite_t *mem_site(const char *);
+memobj_t *mem_slot(void *, memobj_t **);
+void mem_track(void *, size_t, const char *);
+void mem_untrack(memobj_t *);
+int mem_grow(void);
+
+/**
+ * mem_site - finds the statistics of a call site, by the address of its
+ *		name, which is the same string each time the site allocates.
+ * @site: the call site.
+ * Return: its statistics, or those of the sites that find no slot.
+ */
+memsite_t *mem_site(const char *site)
+{
+	size_t i, n, mask = MEM_SITES - 1;
+	memsite_t *s;
+
+	i = ((size_t)site * 2654435761UL) & mask;
+	for (n = 0; n < MEM_SITES; n++, i = (i + 1) & mask)
+	{
+		s = &mem_stats.sites[i];
+		if (s->site == site)
+			return (s);
+		if (!s->site)
+		{
+			s->site = site;
+			return (s);
+		}
+	}
+	return (&mem_stats.sites[MEM_SITES]);
+}
+
+/**
+ * mem_slot - finds the slot of a live object in the table of allocations.
+ * Probing goes on past the slots of objects freed since, and stops at
+ *		a never used slot, of which the table always has some.
+ * @p: the object.
+ * @put: set to the slot to put the object in if it is not in the table,
+ *		NULL while the table has no slots.
+ * Return: the object's slot, or NULL if it is not in the table.
+ */
+memobj_t *mem_slot(void *p, memobj_t **put)
+{
+	size_t mask = mem_stats.nobjs - 1;
+	size_t i = (((size_t)p >> 4) * 2654435761UL) & mask;
+	memobj_t *o;
+
+	*put = NULL;
+	if (!p || !mem_stats.nobjs)
+		return (NULL);
+	for (; (o = &mem_stats.objs[i])->p; i = (i + 1) & mask)
+	{
+		if (o->p == p)
+			return (o);
+		if (o->p == MEM_GONE && !*put)
+			*put = o;
+	}
+	if (!*put)
+		*put = o;
+	return (NULL);
+}
+
+/**
+ * mem_track - counts an allocation against its call site, and remembers
+ *		the object as live unless it failed.
+ * An object already in the table was freed behind the statistics' back,
+ *		by a libc function, and is counted as freed first.
+ * @p: the object, NULL if the allocation failed.
+ * @size: the number of bytes asked for.
+ * @site: the call site.
+ */
+void mem_track(void *p, size_t size, const char *site)
+{
+	memsite_t *s = mem_site(site);
+	memobj_t *o, *put;
+
+	s->calls++;
+	s->bytes += size;
+	if (!p || ((mem_stats.used + 1) * 2 > mem_stats.nobjs &&
+				mem_grow() == -1))
+		return;
+	o = mem_slot(p, &put);
+	if (o)
+	{
+		o->site->live--;
+		o->site->live_bytes -= o->size;
+	}
+	else
+	{
+		o = put;
+		if (!o->p)
+			mem_stats.used++;
+		mem_stats.live++;
+	}
+	o->p = p;
+	o->size = size;
+	o->site = s;
+	s->live++;
+	s->live_bytes += size;
+}
+
+/**
+ * mem_untrack - counts an object as freed.
+ * @o: the object's slot, as mem_slot() found it, or NULL for an object
+ *		that is not in the table, as the memory getline() allocates.
+ */
+void mem_untrack(memobj_t *o)
+{
+	if (!o)
+		return;
+	o->site->live--;
+	o->site->live_bytes -= o->size;
+	o->p = MEM_GONE;
+	mem_stats.live--;
+}
+
+/**
+ * mem_grow - rebuilds the table of allocations, at least four times as
+ *		large as the live objects, without the slots of freed ones.
+ * Return: 0 on success, -1 if memory ran out.
+ */
+int mem_grow(void)
+{
+	memobj_t *old = mem_stats.objs, *o, *put;
+	size_t n = MEM_OBJS_MIN, nold = mem_stats.nobjs;
+
+	while (n < (mem_stats.live + 1) * 4)
+		n *= 2;
+	mem_stats.objs = calloc(n, sizeof(memobj_t));
+	if (!mem_stats.objs)
+	{
+		mem_stats.objs = old;
+		return (-1);
+	}
+	mem_stats.nobjs = n;
+	mem_stats.used = mem_stats.live;
+	for (o = old; o < old + nold; o++)
+		if (o->p && o->p != MEM_GONE)
+		{
+			mem_slot(o->p, &put);
+			*put = *o;
+		}
+	free(old);
+	return (0);
+}
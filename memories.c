@@ -28,8 +28,7 @@ void *_realloc(void *ptr, unsigned int old_size, unsigned int new_size)
 		return (NULL);
 
 	old_size = old_size < new_size ? old_size : new_size;
-	while (old_size--)
-		point[old_size] = ((char *)ptr)[old_size];
+	memcpy(point, ptr, old_size);
 	free(ptr);
 	return (point);
 }
@@ -0,0 +1,125 @@
+#include "shell.h"
+
+int memstats_builtin(shell_t *);
+void mem_print(int, void (*)(char *));
+int mem_compare(const void *, const void *);
+void mem_report(void);
+
+/**
+ * memstats_builtin - implements the memstats command, which prints the
+ *		allocation statistics kept when HSH_MEMSTATS is set.
+ *	memstats	prints the calls, bytes and live objects of each site
+ *	memstats -l	prints only the sites with live objects
+ *	memstats -r	zeroes the calls and bytes, leaving the live objects
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * Return: 0 on success, 1 if the statistics are not kept, 2 on a bad
+ *		option.
+ */
+int memstats_builtin(shell_t *data)
+{
+	int i, live = 0, reset = 0;
+
+	if (!mem_stats.on)
+	{
+		_perror(data, "not kept, HSH_MEMSTATS was not set\n");
+		return (1);
+	}
+	for (i = 1; data->argv[i]; i++)
+		if (!_strcmp(data->argv[i], "-l"))
+			live = 1;
+		else if (!_strcmp(data->argv[i], "-r"))
+			reset = 1;
+		else
+		{
+			_perror(data, "usage: memstats [-l|-r]\n");
+			return (2);
+		}
+	if (!reset)
+	{
+		mem_print(live, _puts);
+		return (0);
+	}
+	pthread_mutex_lock(&mem_stats.lock);
+	for (i = 0; i <= MEM_SITES; i++)
+		mem_stats.sites[i].calls = mem_stats.sites[i].bytes = 0;
+	pthread_mutex_unlock(&mem_stats.lock);
+	return (0);
+}
+
+/**
+ * mem_print - prints the statistics of the call sites, those holding the
+ *		most memory first, then those that allocated the most, and
+ *		their totals.
+ * @live: non-zero to print only the sites with live objects.
+ * @put: prints a string, on standard output or errors.
+ */
+void mem_print(int live, void (*put)(char *))
+{
+	static memsite_t *v[MEM_SITES + 1];
+	memsite_t *s, total;
+	char buf[256];
+	size_t i, n = 0;
+
+	memset(&total, 0, sizeof(total));
+	pthread_mutex_lock(&mem_stats.lock);
+	for (s = mem_stats.sites; s <= mem_stats.sites + MEM_SITES; s++)
+		if (s->site && (s->live || (!live && s->calls)))
+			v[n++] = s;
+	qsort(v, n, sizeof(*v), mem_compare);
+	put("    calls      bytes     live live bytes  site\n");
+	for (i = 0; i < n; i++)
+	{
+		s = v[i];
+		total.calls += s->calls;
+		total.bytes += s->bytes;
+		total.live += s->live;
+		total.live_bytes += s->live_bytes;
+		snprintf(buf, sizeof(buf), "%9lu %10lu %8ld %10ld  %s\n",
+				s->calls, s->bytes, s->live, s->live_bytes,
+				s->site);
+		put(buf);
+	}
+	pthread_mutex_unlock(&mem_stats.lock);
+	snprintf(buf, sizeof(buf), "%9lu %10lu %8ld %10ld  total\n",
+			total.calls, total.bytes, total.live, total.live_bytes);
+	put(buf);
+}
+
+/**
+ * mem_compare - orders call sites by the memory they hold, then by the
+ *		memory they asked for, both decreasing, then by name.
+ * @a: a pointer to the first site.
+ * @b: a pointer to the second site.
+ * Return: a negative number if a goes first, a positive one otherwise.
+ */
+int mem_compare(const void *a, const void *b)
+{
+	const memsite_t *x = *(memsite_t * const *)a;
+	const memsite_t *y = *(memsite_t * const *)b;
+
+	if (x->live_bytes != y->live_bytes)
+		return (x->live_bytes > y->live_bytes ? -1 : 1);
+	if (x->bytes != y->bytes)
+		return (x->bytes > y->bytes ? -1 : 1);
+	return (strcmp(x->site, y->site));
+}
+
+/**
+ * mem_report - lists the objects still allocated when the shell exits,
+ *		by call site, on standard error.
+ * Children that exit without executing a command do not report.
+ */
+void mem_report(void)
+{
+	char buf[128];
+
+	if (getpid() != mem_stats.pid)
+		return;
+	snprintf(buf, sizeof(buf), "memstats: %lu objects still allocated"
+			" at exit\n", (unsigned long)mem_stats.live);
+	_eputs(buf);
+	if (mem_stats.live)
+		mem_print(1, _eputs);
+	_puts2(BUF_FLUSH);
+}
@@ -0,0 +1,55 @@
+#include "shell.h"
+
+int set_builtin(shell_t *);
+int print_options(shell_t *);
+
+/**
+ * set_builtin - implements the -o part of the set command,
+ *		which turns the shell's options on and off.
+ *	set -o			lists the options and their state
+ *	set -o pipefail		turns pipefail on
+ *	set +o pipefail		turns pipefail off
+ * With pipefail on, a pipeline's status is the status of its rightmost
+ *		failed command instead of its last command.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * Return: 0 on success, 2 on an unknown option.
+ */
+int set_builtin(shell_t *data)
+{
+	int i, on;
+
+	for (i = 1; data->argv[i]; i++)
+	{
+		on = !_strcmp(data->argv[i], "-o");
+		if (!on && _strcmp(data->argv[i], "+o"))
+			break;
+		if (!data->argv[i + 1])
+			return (print_options(data));
+		if (_strcmp(data->argv[++i], "pipefail"))
+			break;
+		if (on)
+			data->options |= OPT_PIPEFAIL;
+		else
+			data->options &= ~OPT_PIPEFAIL;
+	}
+	if (!data->argv[i])
+		return (0);
+	_perror(data, "Illegal option ");
+	_eputs(data->argv[i]);
+	_eputs("\n");
+	return (2);
+}
+
+/**
+ * print_options - prints every option of the shell and its state.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * Return: 0 on success.
+ */
+int print_options(shell_t *data)
+{
+	_puts("pipefail\t");
+	_puts(data->options & OPT_PIPEFAIL ? "on\n" : "off\n");
+	return (0);
+}
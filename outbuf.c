@@ -0,0 +1,89 @@
+#include "shell.h"
+
+int out_write(int, const char *, size_t);
+int out_flush(int);
+int out_drain(int, struct iovec *, int);
+
+/*
+ * out - the shell's output buffer. Switching to another descriptor writes
+ * out what the buffer holds first, so that output is never reordered; at
+ * most one descriptor has pending output, and one buffer serves them all.
+ */
+static outbuf_t out = {STDOUT_FILENO, 0, {0}};
+
+/**
+ * out_write - appends bytes to the output of a file descriptor.
+ * When they do not fit, the buffer and the bytes go out together in
+ *		a single writev().
+ * @fd: the file descriptor.
+ * @s: the bytes.
+ * @n: the number of bytes.
+ * Return: 0 on success, -1 if a write failed.
+ */
+int out_write(int fd, const char *s, size_t n)
+{
+	struct iovec iov[2];
+
+	if (out.len && out.fd != fd)
+		out_flush(-1);
+	out.fd = fd;
+	if (out.len + n <= WRITE_BUF_SIZE)
+	{
+		memcpy(out.buf + out.len, s, n);
+		out.len += n;
+		return (0);
+	}
+	iov[0].iov_base = out.buf;
+	iov[0].iov_len = out.len;
+	iov[1].iov_base = (char *)s;
+	iov[1].iov_len = n;
+	out.len = 0;
+	return (out_drain(fd, iov, 2));
+}
+
+/**
+ * out_flush - writes out the buffered output.
+ * @fd: the descriptor whose output is to be written, -1 for any.
+ * Return: 0 on success, -1 if the write failed.
+ */
+int out_flush(int fd)
+{
+	struct iovec iov;
+
+	if (!out.len || (fd != -1 && fd != out.fd))
+		return (0);
+	iov.iov_base = out.buf;
+	iov.iov_len = out.len;
+	out.len = 0;
+	return (out_drain(out.fd, &iov, 1));
+}
+
+/**
+ * out_drain - writes vectors of bytes until all are written, going on
+ *		after a short write or an interrupted one.
+ * @fd: the file descriptor.
+ * @iov: the vectors, consumed as they are written.
+ * @cnt: the number of vectors.
+ * Return: 0 on success, -1 if the write failed; the rest is dropped.
+ */
+int out_drain(int fd, struct iovec *iov, int cnt)
+{
+	ssize_t n;
+
+	while (cnt)
+	{
+		n = writev(fd, iov, cnt);
+		if (n == -1 && errno == EINTR)
+			continue;
+		if (n == -1)
+			return (-1);
+		for (; cnt && (size_t)n >= iov->iov_len; cnt--, iov++)
+			n -= iov->iov_len;
+		if (cnt)
+		{
+			iov->iov_base = (char *)iov->iov_base + n;
+			iov->iov_len -= n;
+		}
+	}
+	return (0);
+}
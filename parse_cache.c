@@ -0,0 +1,122 @@
+#include "shell.h"
+
+int run_line(shell_t *, char **);
+cached_t *cache_lookup(shell_t *, char *);
+cached_t *cache_fill(cached_t *, char *);
+unsigned long hash_line(const char *, size_t *);
+void free_parse_cache(shell_t *);
+
+/**
+ * run_line - runs a line read from the input, compiling it only when
+ *		the same line is not already in the parse cache.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * @argv: array of strings representing the command line arguments from main()
+ * Return: the result of the last command, or -2 when exit was run.
+ */
+int run_line(shell_t *data, char **argv)
+{
+	cached_t *slot = cache_lookup(data, data->arg);
+
+	if (!slot)
+		return (0);
+	return (run_program(data, &slot->prog, argv));
+}
+
+/**
+ * cache_lookup - finds the compiled program of a line in the parse cache.
+ * The cache is direct mapped on the line's hash: on a miss the slot's
+ *		previous line is dropped and the new one is compiled into it.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * @line: the line, without its newline and comments.
+ * Return: the cache slot holding the line, or NULL if memory ran out.
+ */
+cached_t *cache_lookup(shell_t *data, char *line)
+{
+	size_t len;
+	unsigned long hash = hash_line(line, &len);
+	cached_t *slot;
+
+	if (!data->cache)
+		data->cache = calloc(PARSE_CACHE_SIZE, sizeof(cached_t));
+	if (!data->cache)
+		return (NULL);
+	slot = &data->cache[hash % PARSE_CACHE_SIZE];
+	if (slot->line && slot->hash == hash && slot->len == len &&
+			!memcmp(slot->line, line, len))
+		return (slot);
+
+	free(slot->line);
+	free_program(&slot->prog);
+	slot->hash = hash;
+	slot->len = len;
+	return (cache_fill(slot, line));
+}
+
+/**
+ * cache_fill - compiles a line into a parse cache slot.
+ * @slot: the emptied slot, its hash and length already set.
+ * @line: the line.
+ * Return: the slot, or NULL if memory ran out.
+ */
+cached_t *cache_fill(cached_t *slot, char *line)
+{
+	char *text = _strdup(line); /* the program's words point into it */
+
+	slot->line = _strdup(line);
+	if (text && strvec_push(&slot->prog.text, text) == -1)
+	{
+		free(text);
+		text = NULL;
+	}
+	if (!slot->line || !text ||
+			compile_line(&slot->prog, text, 0) == -1)
+	{
+		free(slot->line);
+		slot->line = NULL;
+		free_program(&slot->prog);
+		return (NULL);
+	}
+	return (slot);
+}
+
+/**
+ * hash_line - computes the FNV-1a hash of a line.
+ * @line: the line.
+ * @len: receives the length of the line.
+ * Return: the hash.
+ */
+unsigned long hash_line(const char *line, size_t *len)
+{
+	unsigned long hash = 2166136261UL;
+	const unsigned char *p = (const unsigned char *)line;
+
+	while (*p)
+	{
+		hash ^= *p++;
+		hash *= 16777619UL;
+	}
+	*len = p - (const unsigned char *)line;
+	return (hash);
+}
+
+/**
+ * free_parse_cache - frees every line and program of the parse cache.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ */
+void free_parse_cache(shell_t *data)
+{
+	size_t i;
+
+	if (!data->cache)
+		return;
+	for (i = 0; i < PARSE_CACHE_SIZE; i++)
+	{
+		free(data->cache[i].line);
+		free_program(&data->cache[i].prog);
+	}
+	free(data->cache);
+	data->cache = NULL;
+}
@@ -12,84 +12,49 @@ int _atoi(char *);
  * parse_command - finds a command in PATH
  *	responsible for finding and executing a command
  *		entered by the user in the shell.
+ * The lookup itself is done by resolve_command().
  * @data:  A pointer to the shell data structure,
  * which contains information about the current state of the shell.
  * Return: void
  */
 void parse_command(shell_t *data)
 {
-	char *path = NULL;
-	int i, k;
-
-	data->path = data->argv[0];
-	if (data->display == 1)
-	{
-		data->count++;
-		data->display = 0;
-	}
-	for (i = 0, k = 0; data->arg[i]; i++)
-		if (!isdelimeter(data->arg[i], " \t\n"))
-			k++;
-	if (!k)
-		return;
-
-	path = find_path(data, _getenv(data, "PATH="), data->argv[0]);
-	if (path)
-	{
-		data->path = path;
+	if (resolve_command(data))
 		_forks(data);
-	}
-	else
-	{
-		if ((interactive(data) ||
-					_getenv(data, "PATH=") ||
-					data->argv[0][0] == '/') &&
-				iscommand(data, data->argv[0]))
-			_forks(data);
-		else if (*(data->arg) != '\n')
-		{
-			data->status = 127;
-			_perror(data, "not found\n");
-		}
-	}
 }
 
 /**
  * _forks - creates a child process and execute the command in that process.
+ * The child is started by spawn_command(), with the fork(), vfork()
+ *		or posix_spawn() backend selected by the HSH_SPAWN variable,
+ *		as a foreground job of its own.
  * @data:  A pointer to the shell data structure,
  * which contains information about the current state of the shell.
  * Return: void
  */
 void _forks(shell_t *data)
 {
+	job_t *job = job_new(data, 1);
+	launch_t launch;
 	pid_t child_pid;
+	int err;
 
-	child_pid = fork();
-	if (child_pid == -1)
+	if (!job || job_text(job, data->argv) == -1)
 	{
-		perror("Error:");
+		if (job)
+			job_free(data, job);
+		_eputs("Error:: ");
+		_eputs(strerror(ENOMEM));
+		_eputs("\n");
+		data->status = 2;
 		return;
 	}
-	if (child_pid == 0)
-	{
-		if (execve(data->path, data->argv, get_environ(data)) == -1)
-		{
-			free_data(data, 1);
-			if (errno == EACCES)
-				exit(126);
-			exit(1);
-		}
-	}
-	else
-	{
-		wait(&(data->status));
-		if (WIFEXITED(data->status))
-		{
-			data->status = WEXITSTATUS(data->status);
-			if (data->status == 126)
-				_perror(data, "Permission denied\n");
-		}
-	}
+	job_launch(data, job, &launch, 1);
+	child_pid = spawn_command(data, &launch, &err);
+	if (child_pid == -1)
+		spawn_failed(data, err);
+	job_started(data, job, 0, child_pid);
+	wait_job(data, job);
 }
 
 /**
@@ -116,7 +81,8 @@ int iscommand(shell_t *data, char *path)
 }
 
 /**
- * find_path - finds this cmd in the PATH string
+ * find_path - finds this cmd in the PATH string,
+ *		through the command hash table
  * @data:  A pointer to the shell data structure,
  * which contains information about the current state of the shell.
  * @pathstr: the PATH string
@@ -125,44 +91,16 @@ int iscommand(shell_t *data, char *path)
  */
 char *find_path(shell_t *data, char *pathstr, char *cmd)
 {
-	int i = 0, curr_pos = 0;
-	char *path;
-	list_t *alias;
-
 	if (!pathstr)
 		return (NULL);
 
-	alias = node_prefix(data->alias, cmd, '=');
-	if (alias)
-		return (_strdup(alias->string + _strlen(cmd) + 1));
-
 	if ((_strlen(cmd) > 2) && _strstr(cmd, "./"))
 	{
 		if (iscommand(data, cmd))
 			return (cmd);
 	}
 
-	while (1)
-	{
-		if (!pathstr[i] || pathstr[i] == ':')
-		{
-			path = duplicates(pathstr, curr_pos, i);
-			if (!*path)
-				_strcat(path, cmd);
-			else
-			{
-				_strcat(path, "/");
-				_strcat(path, cmd);
-			}
-			if (iscommand(data, path))
-				return (path);
-			if (!pathstr[i])
-				break;
-			curr_pos = i;
-		}
-		i++;
-	}
-	return (NULL);
+	return (hash_lookup(data, pathstr, cmd));
 }
 
 
@@ -0,0 +1,118 @@
+#include "shell.h"
+
+int compile_line(program_t *, char *, unsigned int);
+int list_operator(char *, size_t *, char **);
+int emit_error(program_t *, char *, unsigned int);
+
+/**
+ * compile_line - parses one line as a list of pipelines joined by
+ *		';', '&', '&&' and '||', and emits an instruction for every
+ *		command.
+ * Each instruction carries the operator in front of it, which is all
+ *		the evaluation of a left-associative and-or list needs.
+ *		A line missing a command around an operator compiles into
+ *		a single syntax error instruction instead.
+ * @prog: the program being compiled.
+ * @line: the line, terminated in place at each operator.
+ * @lineno: the line number kept for error messages, 0 for the current one.
+ * Return: 0 on success, -1 if memory ran out.
+ */
+int compile_line(program_t *prog, char *line, unsigned int lineno)
+{
+	size_t i, start = 0, first = prog->len, words = prog->words.len;
+	size_t redirs = prog->nredirs;
+	int cond = RUN_ALWAYS, next, argc = 1;
+	char *token = NULL;
+
+	for (i = 0; line[i] && argc > 0; i++)
+	{
+		next = list_operator(line, &i, &token);
+		if (next == -1)
+			continue;
+		argc = emit_command(prog, line + start, cond, lineno);
+		if (argc > 0 && next == RUN_ASYNC)
+			prog->code[prog->len - 1].async = 1;
+		cond = next == RUN_ASYNC ? RUN_ALWAYS : next;
+		start = i + 1;
+	}
+	if (argc > 0)
+	{
+		argc = emit_command(prog, line + start, cond, lineno);
+		if (!argc && cond == RUN_ALWAYS) /* blank, ends in ';' or '&' */
+			return (0);
+		token = NULL; /* the line ends in '&&', '||' or '|' */
+	}
+	if (argc > 0 || argc == -1)
+		return (argc == -1 ? -1 : 0);
+	/* nothing of a line with a syntax error runs */
+	prog->len = first;
+	prog->words.len = words;
+	prog->nredirs = redirs;
+	return (emit_error(prog, token, lineno));
+}
+
+/**
+ * list_operator - checks if the current char in the line starts a list
+ *		operator: the "||" or "&&" logical operators, the ";"
+ *		and "&" separators or the "|" pipe, and terminates
+ *		the command in front of it.
+ * @line: the line being parsed
+ * @i: address of the current position, moved to the operator's last char
+ * @token: receives the operator, for error messages
+ * Return: the condition of the command after the operator, RUN_ASYNC
+ *		after "&", or -1 if there is no operator here
+ */
+int list_operator(char *line, size_t *i, char **token)
+{
+	char c = line[*i];
+
+	if (c == ';')
+	{
+		line[*i] = '\0';
+		*token = ";";
+		return (RUN_ALWAYS);
+	}
+	if ((c == '&' || c == '|') && line[*i + 1] == c)
+	{
+		line[(*i)++] = '\0';
+		*token = c == '&' ? "&&" : "||";
+		return (c == '&' ? RUN_IF_OK : RUN_IF_FAIL);
+	}
+	if (c == '&' && *i && (line[*i - 1] == '>' || line[*i - 1] == '<'))
+		return (-1); /* the '&' of a >& or <& redirection */
+	if (c == '|' || c == '&')
+	{
+		line[*i] = '\0';
+		*token = c == '|' ? "|" : "&";
+		return (c == '|' ? RUN_PIPED : RUN_ASYNC);
+	}
+	return (-1);
+}
+
+/**
+ * emit_error - appends a syntax error instruction, an instruction
+ *		without words whose only word slot holds the unexpected token.
+ * @prog: the program being compiled.
+ * @token: the unexpected token, or NULL for an unexpected end of line.
+ * @lineno: the line number kept for error messages.
+ * Return: 0 on success, -1 if memory ran out.
+ */
+int emit_error(program_t *prog, char *token, unsigned int lineno)
+{
+	insn_t *in;
+
+	if (program_reserve(prog) == -1 ||
+			strvec_push(&prog->words, token) == -1)
+		return (-1);
+	in = &prog->code[prog->len++];
+	in->cond = RUN_ALWAYS;
+	in->argv = prog->words.len - 1;
+	in->argc = 0;
+	in->vars = 0;
+	in->async = 0;
+	in->timed = 0;
+	in->redir = 0;
+	in->nredir = 0;
+	in->line = lineno;
+	return (0);
+}
@@ -0,0 +1,175 @@
+#include "shell.h"
+
+int run_pipeline(shell_t *, program_t *, insn_t *, int);
+pid_t run_stage(shell_t *, program_t *, insn_t *, launch_t *);
+pid_t fork_builtin(shell_t *, builtin_t *, launch_t *);
+void apply_launch(launch_t *);
+int job_status(shell_t *, job_t *);
+
+/**
+ * run_pipeline - runs the commands of a pipeline as one job, each
+ *		command reading the output of the one before it.
+ * Every command is started before the shell waits for any of them,
+ *		and the shell closes its copy of each pipe end as soon as
+ *		the child holding it is started. The HSH_PIPESZ variable,
+ *		when set, is the capacity given to the pipes.
+ *		A pipeline followed by '&' runs in the background.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * @prog: the compiled program.
+ * @in: the pipeline's first instruction.
+ * @n: the number of commands in the pipeline.
+ * Return: 0, or -1 if memory ran out.
+ */
+int run_pipeline(shell_t *data, program_t *prog, insn_t *in, int n)
+{
+	job_t *job = job_new(data, n);
+	char *size = _getenv(data, "HSH_PIPESZ=");
+	int i, fds[2], size_n = size ? _atoi(size) : 0, prev = -1;
+	launch_t launch;
+	pid_t pid;
+
+	if (!job)
+		return (-1);
+	for (i = 0; i < n; i++)
+	{
+		fds[0] = fds[1] = -1;
+		if (i < n - 1 && make_pipe(fds, size_n) == -1)
+		{
+			perror("Error:");
+			job->procs[n - 1].status = 2;
+			break;
+		}
+		job_text(job, prog->words.v + in[i].argv);
+		job_launch(data, job, &launch, !in[n - 1].async);
+		launch.fd[0] = prev;
+		launch.fd[1] = fds[1];
+		launch.spare = fds[0];
+		pid = run_stage(data, prog, in + i, &launch);
+		job_started(data, job, i, pid);
+		if (prev != -1)
+			close(prev);
+		if (fds[1] != -1)
+			close(fds[1]);
+		prev = fds[0];
+	}
+	if (prev != -1)
+		close(prev);
+	return (job_finish(data, job, in[n - 1].async));
+}
+
+/**
+ * run_stage - starts one command of a pipeline with the given
+ *		standard file descriptors, without waiting for it.
+ * A builtin runs in a child of its own, like any other command.
+ *		The command's redirections are applied on top of the pipes.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * @prog: the compiled program.
+ * @in: the instruction to start.
+ * @launch: the command's standard file descriptors.
+ * Return: the child's pid, or -1 with the status set if there is none.
+ */
+pid_t run_stage(shell_t *data, program_t *prog, insn_t *in, launch_t *launch)
+{
+	builtin_t *builtin;
+	pid_t pid = -1;
+	int err;
+
+	clear_data(data);
+	if (load_insn(data, prog, in) == -1)
+		return (-1);
+	builtin = data->argc ? lookup_builtin(data->argv[0]) : NULL;
+	if (open_redirs(data, prog, in, launch) == -1)
+		pid = -1;
+	else if (!data->argc) /* only redirections */
+		data->status = 0;
+	else if (builtin)
+		pid = fork_builtin(data, builtin, launch);
+	else if (resolve_command(data))
+	{
+		pid = spawn_command(data, launch, &err);
+		if (pid == -1)
+			spawn_failed(data, err);
+	}
+	close_redirs(launch);
+	free_data(data, 0);
+	data->arg = NULL;
+	return (pid);
+}
+
+/**
+ * fork_builtin - runs a builtin in a child process,
+ *		which exits with the builtin's status.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * @builtin: the builtin to run.
+ * @launch: the child's standard file descriptors.
+ * Return: the child's pid, or -1 with the status set on failure.
+ */
+pid_t fork_builtin(shell_t *data, builtin_t *builtin, launch_t *launch)
+{
+	pid_t pid;
+	int value;
+
+	_putchar(BUF_FLUSH);
+	pid = fork();
+	if (pid == -1)
+		spawn_failed(data, errno);
+	if (pid != 0)
+		return (pid);
+	apply_launch(launch);
+	if (launch->spare != -1)
+		close(launch->spare);
+	value = run_builtin(data, builtin);
+	if (value == -2) /* exit only leaves the child */
+		value = data->estatus == -1 ? data->status : data->estatus;
+	_putchar(BUF_FLUSH);
+	_exit(value);
+}
+
+/**
+ * apply_launch - installs a child's process group, terminal and
+ *		standard file descriptors.
+ * It runs in the child between fork() and execve(), so it only
+ *		makes system calls.
+ * @launch: the launch to apply, or NULL to keep the shell's.
+ */
+void apply_launch(launch_t *launch)
+{
+	int fd;
+
+	if (!launch)
+		return;
+	if (launch->pgid != -1)
+	{
+		setpgid(0, launch->pgid);
+		if (launch->tty != -1) /* SIGTTOU is still ignored here */
+			tcsetpgrp(launch->tty, getpgrp());
+		signal(SIGTSTP, SIG_DFL);
+		signal(SIGTTIN, SIG_DFL);
+		signal(SIGTTOU, SIG_DFL);
+		signal(SIGQUIT, SIG_DFL);
+	}
+	for (fd = 0; fd < 3; fd++)
+		if (launch->fd[fd] != -1)
+			dup2(launch->fd[fd], fd);
+}
+
+/**
+ * job_status - the status of a job: the status of its last command or,
+ *		with pipefail on, of its rightmost command that failed.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * @job: the job.
+ * Return: the status.
+ */
+int job_status(shell_t *data, job_t *job)
+{
+	int i;
+
+	for (i = job->n - 1; i > 0 && (data->options & OPT_PIPEFAIL); i--)
+		if (job->procs[i].status)
+			break;
+	return (job->procs[i].status);
+}
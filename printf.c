@@ -0,0 +1,175 @@
+#include "shell.h"
+
+int printf_builtin(shell_t *);
+int printf_format(shell_t *, char *, char ***, int *);
+int printf_conv(shell_t *, char *, char ***, int *);
+int printf_width(char *, int, char *, int *, char ***);
+void printf_value(shell_t *, char *, int, char *, int *);
+
+/**
+ * printf_builtin - implements the functionality of the printf command.
+ *		The format is used again for as long as arguments are left.
+ *	printf FORMAT [ARGUMENT...]
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * Return: 0 on success, 1 if an argument was invalid, 2 without a format.
+ */
+int printf_builtin(shell_t *data)
+{
+	char **args;
+	int used, status = 0;
+
+	if (!data->argv[1])
+	{
+		_perror(data, "usage: printf format [arg ...]\n");
+		return (2);
+	}
+	args = data->argv + 2;
+	do {
+		used = printf_format(data, data->argv[1], &args, &status);
+	} while (used > 0 && *args);
+	return (status);
+}
+
+/**
+ * printf_format - prints the format once: its backslash escapes,
+ *		and its conversions, each of which takes the next argument.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * @fmt: the format.
+ * @args: address of the next argument, moved past the ones used.
+ * @status: set to 1 if an argument or a conversion was invalid.
+ * Return: the number of arguments used, or -1 if the output stopped.
+ */
+int printf_format(shell_t *data, char *fmt, char ***args, int *status)
+{
+	char **first = *args;
+	int stop = 0, n;
+
+	for (; *fmt && !stop; fmt++)
+	{
+		if (*fmt == '\\' && fmt[1])
+			fmt += put_escape(fmt + 1, 0, &stop);
+		else if (*fmt == '%' && fmt[1] == '%')
+			_putchar(*fmt++);
+		else if (*fmt == '%')
+		{
+			n = printf_conv(data, fmt, args, status);
+			if (n == -1)
+				return (-1);
+			fmt += n;
+		}
+		else
+			_putchar(*fmt);
+	}
+	return (stop ? -1 : (int)(*args - first));
+}
+
+/**
+ * printf_conv - prints one conversion: %[flags][width][.precision]
+ *		followed by one of d i o u x X c s b e E f F g G.
+ * %b prints its argument with its backslash escapes interpreted.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * @fmt: the conversion, from its '%'.
+ * @args: address of the next argument, moved past the ones used.
+ * @status: set to 1 if an argument or the conversion is invalid.
+ * Return: the offset of the conversion character, or -1 if it is invalid.
+ */
+int printf_conv(shell_t *data, char *fmt, char ***args, int *status)
+{
+	char spec[64], *arg;
+	int i = 1, len = 1, stop = 0;
+
+	spec[0] = '%';
+	while (fmt[i] && _strchr("-+ #0", fmt[i]) && len < 8)
+		spec[len++] = fmt[i++];
+	len = printf_width(spec, len, fmt, &i, args);
+	if (fmt[i] == '.')
+	{
+		spec[len++] = fmt[i++];
+		len = printf_width(spec, len, fmt, &i, args);
+	}
+	if (!fmt[i] || !_strchr("diouxXcsbeEfFgG", fmt[i]))
+	{
+		_perror(data, fmt);
+		_eputs(": invalid directive\n");
+		*status = 1;
+		return (-1);
+	}
+	arg = **args ? *(*args)++ : NULL;
+	spec[len++] = fmt[i];
+	spec[len] = '\0';
+	if (fmt[i] != 'b')
+		printf_value(data, spec, len - 1, arg, status);
+	for (; fmt[i] == 'b' && arg && *arg && !stop; arg++)
+		if (*arg == '\\' && arg[1])
+			arg += put_escape(arg + 1, 1, &stop);
+		else
+			_putchar(*arg);
+	return (stop ? -1 : i);
+}
+
+/**
+ * printf_width - copies the width or the precision of a conversion,
+ *		taking it from the next argument when it is a '*'.
+ * @spec: the conversion being built.
+ * @len: its length.
+ * @fmt: the conversion in the format.
+ * @i: address of the position in fmt, moved past the number.
+ * @args: address of the next argument, moved past a '*' one.
+ * Return: the new length of spec.
+ */
+int printf_width(char *spec, int len, char *fmt, int *i, char ***args)
+{
+	char *n = NULL;
+
+	if (fmt[*i] == '*')
+	{
+		(*i)++;
+		n = _itoa(**args ? _atoi(*(*args)++) : 0, 10, 0);
+		if (*n == '-' && spec[len - 1] == '.') /* no precision */
+			return (len - 1);
+	}
+	for (; n && *n && len < 40; n++)
+		spec[len++] = *n;
+	for (; !n && fmt[*i] >= '0' && fmt[*i] <= '9'; (*i)++)
+		if (len < 40)
+			spec[len++] = fmt[*i];
+	return (len);
+}
+
+/**
+ * printf_value - prints an argument with a numeric, character or string
+ *		conversion, formatted by the C library.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * @spec: the conversion, in the C library's syntax.
+ * @len: the offset of the conversion character in spec.
+ * @arg: the argument, NULL when the arguments ran out.
+ * @status: set to 1 if the argument is not a valid number.
+ */
+void printf_value(shell_t *data, char *spec, int len, char *arg, int *status)
+{
+	char conv = spec[len], *out = NULL, c[2] = {0, 0};
+	int n = -1;
+
+	if (_strchr("diouxX", conv))
+	{
+		spec[len] = 'l'; /* %ld, %lx... */
+		spec[len + 1] = conv;
+		spec[len + 2] = '\0';
+		n = asprintf(&out, spec, printf_number(data, arg, status));
+	}
+	else if (_strchr("eEfFgG", conv))
+		n = asprintf(&out, spec, arg ? strtod(arg, NULL) : 0.0);
+	else
+	{
+		c[0] = arg ? arg[0] : '\0';
+		spec[len] = 's';
+		n = asprintf(&out, spec, conv == 'c' ? c : arg ? arg : "");
+	}
+	if (n > 0)
+		_puts(out);
+	free(out);
+}
@@ -0,0 +1,76 @@
+#include "shell.h"
+
+int put_escape(char *, int, int *);
+long printf_number(shell_t *, char *, int *);
+
+/**
+ * put_escape - prints the character of a backslash escape:
+ *		\\ \a \b \e \f \n \r \t \v, \xHH, and an octal \NNN
+ *		or, for echo, \0NNN.
+ * An unknown escape is printed as it is.
+ * @s: the escape, just after its backslash.
+ * @echo: non-zero for echo's octal form.
+ * @stop: set to 1 by \c, which ends the output.
+ * Return: the number of characters of the escape after its backslash.
+ */
+int put_escape(char *s, int echo, int *stop)
+{
+	char *from = "\\abefnrtv", *to = "\\\a\b\033\f\n\r\t\v", *c = NULL;
+	int i = 0, n = 0, base = 8, max = 3, digit;
+
+	if (*s)
+		c = _strchr(from, *s);
+	if (c)
+		return (_putchar(to[c - from]));
+	if (*s == 'c')
+		return (*stop = 1);
+	if (*s == 'x' || (echo && *s == '0'))
+	{
+		base = *s == 'x' ? 16 : 8;
+		i = 1;
+		max = *s == 'x' ? 3 : 4;
+	}
+	for (; i < max; i++)
+	{
+		digit = s[i] >= '0' && s[i] <= '9' ? s[i] - '0' :
+			s[i] >= 'a' && s[i] <= 'f' ? s[i] - 'a' + 10 :
+			s[i] >= 'A' && s[i] <= 'F' ? s[i] - 'A' + 10 : 16;
+		if (digit >= base)
+			break;
+		n = n * base + digit;
+	}
+	if (!i || (base == 16 && i == 1)) /* not an escape after all */
+		return (_putchar('\\') - 1);
+	_putchar((char)n);
+	return (i);
+}
+
+/**
+ * printf_number - converts an argument of a numeric printf conversion.
+ * The argument is a C constant, decimal, octal or hexadecimal, or a
+ *		quote followed by a character, which stands for its code.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * @arg: the argument, NULL when the arguments ran out.
+ * @status: set to 1 if the argument is not a valid number.
+ * Return: the number, or the value of its valid beginning.
+ */
+long printf_number(shell_t *data, char *arg, int *status)
+{
+	char *end;
+	long value;
+
+	if (!arg || !*arg)
+		return (0);
+	if (*arg == '\'' || *arg == '"')
+		return ((unsigned char)arg[1]);
+	errno = 0;
+	value = strtol(arg, &end, 0);
+	if (*end || errno)
+	{
+		_perror(data, arg);
+		_eputs(*end ? ": invalid number\n" : ": out of range\n");
+		*status = 1;
+	}
+	return (value);
+}
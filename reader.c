@@ -0,0 +1,136 @@
+#include "shell.h"
+
+int _getline(shell_t *, char **, size_t *);
+ssize_t read_buffer(shell_t *, reader_t *);
+size_t read_block_size(int);
+void free_reader(reader_t *);
+
+/**
+ * _getline - a utility function used by the shell program
+ * to read input from the user and manage the input buffer dynamically.
+ * The line is handed out as a slice of the reader's buffer, still ending
+ *		in its newline, and stays valid until the next call.
+ * @data:  A pointer to the shell data structure,
+ * which contains information about the current state of the shell.
+ * @ptr: address of the pointer that receives the line
+ * @length: the length of the line.
+ * Return:  returns the length of the newly read line, -1 at end of input.
+ */
+int _getline(shell_t *data, char **ptr, size_t *length)
+{
+	reader_t *r = &data->in;
+	size_t scanned = 0, len;
+	ssize_t value;
+	char *c = NULL;
+
+	if (data->map) /* script is mapped, hand out a slice of it */
+		return (map_getline(data, ptr, length));
+
+	while (1)
+	{
+		if (r->end > r->start + scanned)
+			c = memchr(r->buf + r->start + scanned, '\n',
+					r->end - r->start - scanned);
+		if (c || r->eof)
+			break;
+		scanned = r->end - r->start;
+		value = read_buffer(data, r);
+		if (value == -1)
+			return (-1);
+	}
+
+	len = c ? (size_t)(c - (r->buf + r->start)) + 1 : r->end - r->start;
+	if (!len)
+		return (-1);
+	*ptr = r->buf + r->start;
+	if (!c) /* terminate a last line that has no newline */
+		(*ptr)[len] = '\0';
+	r->start += len;
+	if (length)
+		*length = len;
+	return (len);
+}
+
+/**
+ * read_buffer - responsible for reading input
+ *		from the file descriptor into the reader's buffer.
+ * Unconsumed bytes are moved to the front of the buffer first, and the
+ *		buffer doubles whenever a block would not fit, so a long line
+ *		costs a handful of copies instead of one per block.
+ * @data:  A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * @r: the line reader to fill.
+ * Return: returns the value of reading,
+ * which represents the number of bytes read from the file descriptor.
+ */
+ssize_t read_buffer(shell_t *data, reader_t *r)
+{
+	ssize_t reading;
+	size_t cap;
+	char *buf;
+
+	if (!r->block)
+		r->block = read_block_size(data->file_descriptor);
+	if (r->start && r->cap - r->end <= r->block)
+	{
+		memmove(r->buf, r->buf + r->start, r->end - r->start);
+		r->end -= r->start;
+		r->start = 0;
+	}
+	if (r->cap - r->end <= r->block)
+	{
+		cap = r->cap ? r->cap * 2 : r->block + 1;
+		while (cap - r->end <= r->block)
+			cap *= 2;
+		buf = realloc(r->buf, cap);
+		if (!buf)
+			return (-1);
+		r->buf = buf;
+		r->cap = cap;
+	}
+	_putchar(BUF_FLUSH); /* the output goes out before the shell blocks */
+	/* one byte is always kept free to terminate a last bare line */
+	reading = read(data->file_descriptor, r->buf + r->end,
+			r->cap - r->end - 1);
+	if (reading > 0)
+		r->end += reading;
+	else
+		r->eof = 1;
+	return (reading);
+}
+
+/**
+ * read_block_size - picks how much to ask read() for on a file descriptor.
+ * Terminals deliver a line at a time, pipes hold as much as their capacity
+ *		and regular files can be taken in large blocks.
+ * @fd: the input file descriptor.
+ * Return: the preferred read size in bytes.
+ */
+size_t read_block_size(int fd)
+{
+	struct stat st;
+	long size = READ_BUF_SIZE;
+
+	if (isatty(fd) || fstat(fd, &st))
+		return (READ_BUF_SIZE);
+#ifdef F_GETPIPE_SZ
+	if (S_ISFIFO(st.st_mode))
+		size = fcntl(fd, F_GETPIPE_SZ);
+#endif
+	if (S_ISREG(st.st_mode))
+		size = st.st_size;
+	if (size < READ_BUF_SIZE)
+		return (READ_BUF_SIZE);
+	return (size > READ_BUF_MAX ? READ_BUF_MAX : (size_t)size);
+}
+
+/**
+ * free_reader - releases the line reader's buffer.
+ * @r: the line reader.
+ */
+void free_reader(reader_t *r)
+{
+	free(r->buf);
+	r->buf = NULL;
+	r->cap = r->start = r->end = 0;
+}
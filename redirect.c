@@ -0,0 +1,166 @@
+#include "shell.h"
+
+int open_redirs(shell_t *, program_t *, insn_t *, launch_t *);
+int redir_source(shell_t *, redir_t *, launch_t *, int *);
+void redir_install(launch_t *, int, int, int);
+void close_redirs(launch_t *);
+int redir_error(shell_t *, char *, char *, int);
+
+/**
+ * open_redirs - resolves the redirections of a command, from left to
+ *		right, into the descriptors its process is launched with.
+ * The files are opened by the shell, close-on-exec, so that a failure
+ *		is reported before anything is started, and so that a builtin
+ *		can use the same descriptors without a fork.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * @prog: the compiled program.
+ * @in: the command's instruction.
+ * @launch: the launch to update; its descriptors may already be pipes.
+ * Return: 0 on success, -1 with the status set to 2 on failure.
+ */
+int open_redirs(shell_t *data, program_t *prog, insn_t *in,
+		launch_t *launch)
+{
+	redir_t *r = prog->redirs + in->redir;
+	int i, fd, opened;
+
+	for (i = 0; i < in->nredir; i++)
+	{
+		fd = redir_source(data, &r[i], launch, &opened);
+		if (fd == -1)
+		{
+			close_redirs(launch);
+			data->status = 2;
+			return (-1);
+		}
+		redir_install(launch, r[i].fd, fd, opened);
+	}
+	return (0);
+}
+
+/**
+ * redir_source - finds the descriptor a redirection installs:
+ *		a file it opens, or the descriptor it copies.
+ * A copy of a descriptor that is not redirected yet copies the shell's
+ *		own, duplicated above the standard ones so that a later
+ *		redirection of it does not change what was copied.
+ * The target's parameters are expanded first.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * @r: the redirection.
+ * @launch: the redirections resolved so far.
+ * @opened: receives 1 if the descriptor was opened for the redirection.
+ * Return: the descriptor, or -1 after printing an error.
+ */
+int redir_source(shell_t *data, redir_t *r, launch_t *launch, int *opened)
+{
+	char *target = redir_target(data, r);
+	int fd, flags = O_RDONLY;
+
+	*opened = 1;
+	if (!target)
+		return (redir_error(data, "", r->target, ENOMEM));
+	if (r->fd > 2)
+		return (redir_error(data, "Bad fd number", NULL, 0));
+	if (r->op == REDIR_DUP)
+	{
+		fd = _atoi(target);
+		if (fd < 0 || fd > 2)
+			return (redir_error(data, "Bad fd number", NULL, 0));
+		if (launch->fd[fd] != -1)
+		{
+			*opened = 0;
+			return (launch->fd[fd]);
+		}
+		fd = fcntl(fd, F_DUPFD_CLOEXEC, 10);
+		if (fd == -1)
+			return (redir_error(data, "Bad fd number", NULL, 0));
+		return (fd);
+	}
+	if (r->op == REDIR_OUT)
+		flags = O_WRONLY | O_CREAT | O_TRUNC;
+	else if (r->op == REDIR_APPEND)
+		flags = O_WRONLY | O_CREAT | O_APPEND;
+	if (r->op != REDIR_IN)
+		stat_cache_flush(data); /* the file may be created or emptied */
+	fd = open(target, flags | O_CLOEXEC, 0666);
+	if (fd == -1)
+		return (redir_error(data, r->op == REDIR_IN ? "cannot open " :
+					"cannot create ", target, errno));
+	return (fd);
+}
+
+/**
+ * redir_install - makes a descriptor the source of one of the standard
+ *		ones, closing a file opened earlier once nothing uses it.
+ * @launch: the launch.
+ * @target: the standard descriptor redirected.
+ * @fd: the descriptor installed.
+ * @opened: non-zero if fd was opened for the redirection.
+ */
+void redir_install(launch_t *launch, int target, int fd, int opened)
+{
+	int i, *own = launch->own;
+
+	launch->fd[target] = fd;
+	for (i = 0; i < 3; i++)
+		if (own[i] != -1 && own[i] != launch->fd[0] &&
+				own[i] != launch->fd[1] &&
+				own[i] != launch->fd[2])
+		{
+			close(own[i]);
+			own[i] = -1;
+		}
+	for (i = 0; opened && i < 3; i++)
+		if (own[i] == -1)
+		{
+			own[i] = fd;
+			break;
+		}
+}
+
+/**
+ * close_redirs - closes the files opened for redirections,
+ *		once the command was started.
+ * @launch: the launch.
+ */
+void close_redirs(launch_t *launch)
+{
+	int i;
+
+	for (i = 0; i < 3; i++)
+		if (launch->own[i] != -1)
+		{
+			close(launch->own[i]);
+			launch->own[i] = -1;
+		}
+}
+
+/**
+ * redir_error - prints the error of a failed redirection.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * @msg: the message.
+ * @target: the file, NULL if there is none.
+ * @err: the errno of the failure, 0 if there is none.
+ * Return: -1.
+ */
+int redir_error(shell_t *data, char *msg, char *target, int err)
+{
+	_eputs(data->fname);
+	_eputs(": ");
+	decimal(data->count, STDERR_FILENO);
+	_eputs(": ");
+	_eputs(msg);
+	if (target)
+		_eputs(target);
+	if (err)
+	{
+		_eputs(": ");
+		_eputs(strerror(err));
+	}
+	_eputs("\n");
+	_puts2(BUF_FLUSH);
+	return (-1);
+}
@@ -0,0 +1,138 @@
+#include "shell.h"
+
+int emit_redirs(program_t *, size_t, insn_t *);
+int parse_redir(char *, redir_t *);
+int redir_push(program_t *, redir_t *);
+char *redir_target(shell_t *, redir_t *);
+
+/**
+ * emit_redirs - takes the redirections out of the words of a command
+ *		and records them in the program, in order.
+ * The remaining words are moved down over the removed ones.
+ * @prog: the program being compiled.
+ * @first: index of the command's first word in the word pool.
+ * @in: the command's instruction, which receives its word count
+ *		and its redirections.
+ * Return: 0 on success, -1 if memory ran out,
+ *		-2 if a redirection has no target.
+ */
+int emit_redirs(program_t *prog, size_t first, insn_t *in)
+{
+	char **w = prog->words.v;
+	size_t i, o = first;
+	redir_t r;
+	int at;
+
+	in->redir = prog->nredirs;
+	in->nredir = 0;
+	for (i = first; w[i]; i++)
+	{
+		at = parse_redir(w[i], &r);
+		if (at)
+			w[o++] = w[i]; /* a word, or the word in front of one */
+		if (at == -1)
+			continue;
+		if (!r.target && !w[i + 1])
+			return (-2);
+		if (!r.target)
+			r.target = w[++i];
+		if (redir_push(prog, &r) == -1)
+			return (-1);
+		in->nredir++;
+	}
+	w[o] = NULL;
+	prog->words.len = o + 1;
+	in->argc = o - first;
+	return (0);
+}
+
+/**
+ * parse_redir - checks if a word holds a redirection operator:
+ *		<, >, >>, <& or >&, optionally preceded by a descriptor
+ *		number and followed by the target.
+ * Anything else in front of the operator is a word of its own,
+ *		terminated in place.
+ * @word: the word.
+ * @r: receives the redirection, with a NULL target when the target
+ *		is the next word.
+ * Return: -1 if there is no redirection, 0 if the whole word is one,
+ *		or the length of the word in front of it.
+ */
+int parse_redir(char *word, redir_t *r)
+{
+	size_t i = 0, op;
+	int digits = 1, fd = 0;
+
+	for (; word[i] && word[i] != '<' && word[i] != '>'; i++)
+	{
+		digits &= word[i] >= '0' && word[i] <= '9';
+		if (digits && fd < 1000)
+			fd = fd * 10 + word[i] - '0';
+	}
+	if (!word[i])
+		return (-1);
+	op = i;
+	r->fd = op && digits ? fd : word[i] == '>';
+	r->op = word[i] == '<' ? REDIR_IN : REDIR_OUT;
+	if ((word[i] == '>' && word[i + 1] == '>') || word[i + 1] == '&')
+	{
+		r->op = word[i + 1] == '&' ? REDIR_DUP : REDIR_APPEND;
+		i++;
+	}
+	r->target = word[i + 1] ? word + i + 1 : NULL;
+	word[op] = '\0';
+	return (op && digits ? 0 : (int)op);
+}
+
+/**
+ * redir_push - appends a redirection to a program,
+ *		doubling the array when it is full.
+ * @prog: the program being compiled.
+ * @r: the redirection.
+ * Return: 0 on success, -1 if memory ran out.
+ */
+int redir_push(program_t *prog, redir_t *r)
+{
+	redir_t *redirs;
+	size_t cap;
+
+	if (prog->nredirs == prog->redir_cap)
+	{
+		cap = prog->redir_cap ? prog->redir_cap * 2 : 8;
+		redirs = realloc(prog->redirs, sizeof(redir_t) * cap);
+		if (!redirs)
+			return (-1);
+		prog->redirs = redirs;
+		prog->redir_cap = cap;
+	}
+	prog->redirs[prog->nredirs++] = *r;
+	return (0);
+}
+
+/**
+ * redir_target - replaces the parameters in the target of a redirection,
+ *		as in > $LOGDIR/log, with their values.
+ * The target is expanded in a scratch buffer of its own, as the command's
+ *		words may point into the shell's, then kept on the arena.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * @r: the redirection.
+ * Return: the target, or NULL if memory ran out.
+ */
+char *redir_target(shell_t *data, redir_t *r)
+{
+	strbuf_t words = data->scratch;
+	char *target = r->target;
+
+	if (!_strchr(target, '$'))
+		return (target);
+	memset(&data->scratch, 0, sizeof(data->scratch));
+	if (expand_word(data, target) == -1)
+		target = NULL;
+	else
+		target = arena_strndup(&data->arena, data->scratch.s,
+				data->scratch.len - 1);
+	free(data->scratch.s);
+	data->scratch = words;
+	return (target);
+}
@@ -0,0 +1,74 @@
+#include "shell.h"
+
+void launch_init(launch_t *);
+int swap_fds(launch_t *, int *);
+void restore_fds(int *);
+
+/**
+ * launch_init - prepares a launch that inherits every descriptor
+ *		and stays in the shell's process group.
+ * @launch: the launch.
+ */
+void launch_init(launch_t *launch)
+{
+	int i;
+
+	for (i = 0; i < 3; i++)
+	{
+		launch->fd[i] = -1;
+		launch->own[i] = -1;
+	}
+	launch->spare = -1;
+	launch->pgid = -1;
+	launch->tty = -1;
+}
+
+/**
+ * swap_fds - installs the redirected descriptors in the shell itself,
+ *		so a builtin writes to them without a fork, and saves the
+ *		shell's own for restore_fds().
+ * Buffered output is flushed first, so it goes where it was meant to.
+ * @launch: the redirections, or NULL if there are none.
+ * @saved: receives copies of the three standard descriptors:
+ *		-2 for one that is not redirected, -1 for one that was closed.
+ * Return: 0.
+ */
+int swap_fds(launch_t *launch, int *saved)
+{
+	int fd;
+
+	_putchar(BUF_FLUSH);
+	for (fd = 0; fd < 3; fd++)
+	{
+		saved[fd] = -2;
+		if (!launch || launch->fd[fd] == -1)
+			continue;
+		saved[fd] = fcntl(fd, F_DUPFD_CLOEXEC, 10);
+		dup2(launch->fd[fd], fd);
+	}
+	return (0);
+}
+
+/**
+ * restore_fds - puts back the descriptors saved by swap_fds(),
+ *		after flushing what the builtin wrote to the redirected ones.
+ * @saved: the saved descriptors.
+ */
+void restore_fds(int *saved)
+{
+	int fd;
+
+	_putchar(BUF_FLUSH);
+	for (fd = 0; fd < 3; fd++)
+	{
+		if (saved[fd] == -2)
+			continue;
+		if (saved[fd] == -1)
+			close(fd);
+		else
+		{
+			dup2(saved[fd], fd);
+			close(saved[fd]);
+		}
+	}
+}
@@ -0,0 +1,116 @@
+#include "shell.h"
+
+int map_script(shell_t *);
+int map_getline(shell_t *, char **, size_t *);
+void release_line(shell_t *, char **);
+void unmap_script(shell_t *);
+
+/**
+ * map_script - maps the script file opened by main() into memory,
+ *		so its lines can be handed out as slices of the mapping
+ *		instead of being read() and copied a block at a time.
+ * The mapping is private and writable: the parser terminates words in place,
+ *		which only copies the pages it actually touches.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * Return: 0 if the file was mapped, -1 to fall back to read().
+ */
+int map_script(shell_t *data)
+{
+	struct stat st;
+	void *map;
+
+	if (data->file_descriptor <= 2 || fstat(data->file_descriptor, &st))
+		return (-1);
+	if (!S_ISREG(st.st_mode) || st.st_size <= 0)
+		return (-1);
+
+	map = mmap(NULL, st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE,
+			data->file_descriptor, 0);
+	if (map == MAP_FAILED)
+		return (-1);
+	madvise(map, st.st_size, MADV_SEQUENTIAL);
+
+	data->map = map;
+	data->map_size = st.st_size;
+	data->map_pos = 0;
+	return (0);
+}
+
+/**
+ * map_getline - hands out the next line of a mapped script.
+ * The line is a slice of the mapping that still ends in its newline,
+ *		exactly like a line returned by _getline(); only a last line
+ *		without a newline is copied, since it cannot be terminated in place.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * @ptr: address of the pointer that receives the line.
+ * @length: receives the length of the line.
+ * Return: the length of the line, or -1 at the end of the script.
+ */
+int map_getline(shell_t *data, char **ptr, size_t *length)
+{
+	char *start, *end;
+	size_t len;
+
+	if (data->map_pos >= data->map_size)
+		return (-1);
+
+	start = data->map + data->map_pos;
+	end = memchr(start, '\n', data->map_size - data->map_pos);
+	if (end)
+		len = end - start + 1;
+	else
+	{
+		len = data->map_size - data->map_pos;
+		free(data->map_tail);
+		data->map_tail = malloc(len + 1);
+		if (!data->map_tail)
+			return (-1);
+		memcpy(data->map_tail, start, len);
+		data->map_tail[len] = '\0';
+		start = data->map_tail;
+	}
+	data->map_pos += len;
+
+	*ptr = start;
+	if (length)
+		*length = len;
+	return (len);
+}
+
+/**
+ * release_line - frees a line returned by _getline(), unless it is
+ *		a slice of the reader's buffer, of the mapped script or its copied
+ *		last line.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * @line: address of the line pointer, set to NULL afterwards.
+ */
+void release_line(shell_t *data, char **line)
+{
+	char *p = *line, *map = data->map, *buf = data->in.buf;
+
+	if (!p)
+		return;
+	if (p != data->map_tail &&
+			!(map && p >= map && p < map + data->map_size) &&
+			!(buf && p >= buf && p < buf + data->in.cap))
+		free(p);
+	*line = NULL;
+}
+
+/**
+ * unmap_script - releases the script mapping and the copied last line.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ */
+void unmap_script(shell_t *data)
+{
+	if (data->map)
+		munmap(data->map, data->map_size);
+	data->map = NULL;
+	data->map_size = data->map_pos = 0;
+	free(data->map_tail);
+	data->map_tail = NULL;
+}
@@ -1,6 +1,7 @@
 #ifndef SHELL_H
 #define SHELL_H
 
+#define _GNU_SOURCE /* F_GETPIPE_SZ and other Linux extensions */
 #include <stdio.h> /* input and output functions */
 #include <stdlib.h> /* memory allocation and process control functions */
 #include <unistd.h> /* POSIX operating system API functions */
@@ -13,12 +14,27 @@
 #include <fcntl.h> /* file control options and functions */
 #include <errno.h> /* the errno variable */
 #include <ctype.h> /* character classification and conversion */
-#include <glob.h> /* pattern matching and file globbing */
+#include <dirent.h> /* readdir(), for pathname expansion */
+#include <spawn.h> /* posix_spawn() */
+#include <sys/mman.h> /* memory mapped script input */
+#include <sys/resource.h> /* struct rusage, wait4() */
+#include <sys/time.h> /* timeradd() */
+#include <time.h> /* clock_gettime() */
+#include <sys/socket.h> /* the zygote's socket and SCM_RIGHTS */
+#include <sys/uio.h> /* writev() */
+#include <signal.h> /* pthread_sigmask() */
+#include <pthread.h> /* the threads walking directory trees for ** */
 
 #define READ_BUF_SIZE 1024
-#define WRITE_BUF_SIZE 1024
+#define READ_BUF_MAX (1024 * 1024)
+#define WRITE_BUF_SIZE 8192
 #define BUF_FLUSH -1
 
+#define SPAWN_POSIX 0 /* HSH_SPAWN=posix_spawn, the default */
+#define SPAWN_FORK 1 /* HSH_SPAWN=fork */
+#define SPAWN_VFORK 2 /* HSH_SPAWN=vfork */
+#define SPAWN_ZYGOTE 3 /* HSH_SPAWN=zygote */
+
 extern char **environ;
 
 /**
@@ -43,6 +59,419 @@ char **list_to_strings(list_t *);
 list_t *node_prefix(list_t *, char *, char);
 ssize_t find_index(list_t *, list_t *);
 
+/**
+ * struct strvec_s - a growable array of string pointers
+ * @v: the strings
+ * @len: the number of used slots
+ * @cap: the number of allocated slots
+ */
+typedef struct strvec_s
+{
+	char **v;
+	size_t len;
+	size_t cap;
+} strvec_t;
+
+/**
+ * struct strbuf_s - a growable array of characters
+ * @s: the characters, not terminated
+ * @len: the number of used bytes
+ * @cap: the number of allocated bytes
+ */
+typedef struct strbuf_s
+{
+	char *s;
+	size_t len;
+	size_t cap;
+} strbuf_t;
+
+#define ARENA_CHUNK_SIZE 16384
+#define ARENA_ALIGN sizeof(void *)
+
+/**
+ * struct arena_chunk_s - a block of memory of an arena, followed by the
+ *		memory it hands out
+ * @next: the chunk allocated before it
+ * @size: the number of bytes it hands out
+ * @used: the number of bytes handed out
+ */
+typedef struct arena_chunk_s
+{
+	struct arena_chunk_s *next;
+	size_t size;
+	size_t used;
+} arena_chunk_t;
+
+/**
+ * struct arena_s - memory handed out by bumping a pointer, and given back
+ *		all at once
+ * @head: the chunk being handed out, followed by those before it
+ */
+typedef struct arena_s
+{
+	arena_chunk_t *head;
+} arena_t;
+
+/* tests character c against a 256-bit delimiter table */
+#define IS_DELIM(table, c) \
+	((table)[(unsigned char)(c) >> 3] & (1 << ((unsigned char)(c) & 7)))
+
+extern const unsigned char blank_delims[32];
+
+/* tests whether c may be part of a variable name */
+#define IS_NAME_CHAR(c) ((c) == '_' || ((c) >= 'a' && (c) <= 'z') || \
+		((c) >= 'A' && (c) <= 'Z') || ((c) >= '0' && (c) <= '9'))
+
+/* a machine word, which may alias the characters of a string */
+typedef unsigned long __attribute__((__may_alias__)) strword_t;
+
+/* tests whether a word has a zero byte */
+#define STR_ONES (~0UL / 0xFF)
+#define STR_HAS_ZERO(w) (((w) - STR_ONES) & ~(w) & (STR_ONES << 7))
+
+/*
+ * The string scanners load whole aligned words or vectors, which may go
+ * past the end of a string but never into another page; the sanitizers
+ * would take that for an overflow, or a race.
+ */
+#define STR_SCAN __attribute__((no_sanitize_address, no_sanitize_thread))
+#define STR_AVX2 __attribute__((target("avx2")))
+#define STR_PAGE 4096
+
+/**
+ * struct strops_s - the string scanners suited to the processor, as
+ *		picked by str_init(): with AVX2, SSE2, or a word at a time
+ * @len: returns the length of a string
+ * @chr: returns the first occurrence of a character in a string, or its
+ *		terminating '\0'
+ * @cmp: returns the index at which two strings differ, or both end
+ */
+typedef struct strops_s
+{
+	size_t (*len)(const char *);
+	const char *(*chr)(const char *, int);
+	size_t (*cmp)(const char *, const char *);
+} strops_t;
+
+extern strops_t str_ops;
+
+#define MEM_SITES 1024 /* call sites told apart; the rest count as one */
+#define MEM_OBJS_MIN 1024
+#define MEM_GONE ((void *)1) /* the slot of an object freed since */
+
+/**
+ * struct memsite_s - the allocations made at one call site
+ * @site: the site, as "file.c:line", NULL while the slot is unused
+ * @calls: the number of allocations and reallocations made there
+ * @bytes: the number of bytes they asked for
+ * @live: the number of objects allocated there, not freed yet
+ * @live_bytes: the size of those objects
+ */
+typedef struct memsite_s
+{
+	const char *site;
+	unsigned long calls;
+	unsigned long bytes;
+	long live;
+	long live_bytes;
+} memsite_t;
+
+/**
+ * struct memobj_s - a live object, in the table of allocations
+ * @p: the object, NULL for a slot never used, or MEM_GONE
+ * @size: its size
+ * @site: the site that allocated it
+ */
+typedef struct memobj_s
+{
+	void *p;
+	size_t size;
+	memsite_t *site;
+} memobj_t;
+
+/**
+ * struct memstats_s - the allocation statistics, kept when HSH_MEMSTATS
+ *		is set as the shell starts
+ * @on: non-zero when they are kept
+ * @pid: the shell, whose children do not report at exit
+ * @lock: held while they change, the ** walkers allocating too
+ * @sites: the call sites, hashed by the address of their name, followed
+ *		by the one the sites that find no slot count as
+ * @objs: the live objects, an open addressing table keyed by address
+ * @nobjs: the number of slots of objs, a power of two
+ * @used: the number of slots of objs not NULL
+ * @live: the number of live objects
+ */
+typedef struct memstats_s
+{
+	int on;
+	pid_t pid;
+	pthread_mutex_t lock;
+	memsite_t sites[MEM_SITES + 1];
+	memobj_t *objs;
+	size_t nobjs;
+	size_t used;
+	size_t live;
+} memstats_t;
+
+extern memstats_t mem_stats;
+
+/*
+ * Every allocation of the shell goes through these, so that with
+ * HSH_MEMSTATS set it is counted against the line that made it; otherwise
+ * they cost a test. Memory that libc allocates for the shell, as for
+ * getline() or asprintf(), is not counted, and freeing it is not either.
+ */
+#define MEM_STR(x) #x
+#define MEM_LINE(x) MEM_STR(x)
+#define MEM_SITE (__FILE__ ":" MEM_LINE(__LINE__))
+#define malloc(n) (mem_stats.on ? mem_malloc((n), MEM_SITE) : malloc(n))
+#define calloc(n, size) (mem_stats.on ? \
+		mem_calloc((n), (size), MEM_SITE) : calloc((n), (size)))
+#define realloc(p, n) (mem_stats.on ? \
+		mem_realloc((p), (n), MEM_SITE) : realloc((p), (n)))
+#define free(p) (mem_stats.on ? mem_free(p) : free(p))
+#define _strdup(s) _strdup_at((s), MEM_SITE)
+
+/**
+ * struct outbuf_s - buffered output, for one file descriptor at a time
+ * @fd: the descriptor the buffered bytes are for
+ * @len: the number of buffered bytes
+ * @buf: the bytes
+ */
+typedef struct outbuf_s
+{
+	int fd;
+	size_t len;
+	char buf[WRITE_BUF_SIZE];
+} outbuf_t;
+
+/**
+ * struct reader_s - buffered line reader used when input is not mapped
+ * @buf: the read buffer, lines are handed out as slices of it
+ * @cap: allocated size of buf
+ * @start: offset of the first byte not yet handed out
+ * @end: offset one past the last byte read
+ * @block: preferred read size for the input file descriptor
+ * @eof: set once read() reported the end of the input
+ */
+typedef struct reader_s
+{
+	char *buf;
+	size_t cap;
+	size_t start;
+	size_t end;
+	size_t block;
+	int eof;
+} reader_t;
+
+#define ENV_FREE -1 /* an env slot never used */
+#define ENV_GONE -2 /* an env slot whose variable was unset */
+
+/**
+ * struct envent_s - an environment variable
+ * @nlen: the length of its name
+ * @hash: the FNV-1a hash of its name
+ */
+typedef struct envent_s
+{
+	size_t nlen;
+	unsigned long hash;
+} envent_t;
+
+/**
+ * struct envtab_s - the environment: an open addressing hash table of
+ *		indices into an array that keeps the variables in the order
+ *		they were first set
+ * @ents: the names of the variables
+ * @envp: the variables as NAME=value, in step with ents, NULL where one
+ *		was unset and NULL terminated: once it has no holes, it is the
+ *		environment of the commands as it is
+ * @len: the number of entries used in ents, holes included
+ * @cap: the number of entries allocated, plus one in envp
+ * @count: the number of variables
+ * @holes: the number of holes, closed before envp is next used
+ * @slots: indices into ents, or ENV_FREE or ENV_GONE, probed linearly
+ * @nslots: the number of slots, a power of two at least twice cap
+ */
+typedef struct envtab_s
+{
+	envent_t *ents;
+	char **envp;
+	size_t len;
+	size_t cap;
+	size_t count;
+	size_t holes;
+	long *slots;
+	size_t nslots;
+} envtab_t;
+
+#define ALIAS_HASH_SIZE 256
+
+/**
+ * struct alias_s - an alias, its value split into words once, when it
+ *		is defined
+ * @text: the definition, as name=value
+ * @nlen: the length of the name
+ * @hash: the FNV-1a hash of the name
+ * @body: a copy of the value, the words are slices of
+ * @words: the words of the value, NULL terminated
+ * @blank: non-zero when the value ends with a blank, which has the word
+ *		after the alias checked for an alias too
+ * @active: non-zero while the alias is being expanded, so that an alias
+ *		that refers to itself, directly or not, stops there
+ * @seq: when the alias was defined, to list the aliases in that order
+ * @next: the next alias of the bucket
+ */
+typedef struct alias_s
+{
+	char *text;
+	size_t nlen;
+	unsigned long hash;
+	char *body;
+	strvec_t words;
+	int blank;
+	int active;
+	unsigned long seq;
+	struct alias_s *next;
+} alias_t;
+
+/**
+ * struct aliastab_s - the aliases, chained by the hash of their name
+ * @buckets: the chains
+ * @count: the number of aliases
+ * @seq: the sequence number of the last definition
+ * @retired: the aliases removed or redefined by the current command,
+ *		chained by @next and freed after it, as its words may be theirs
+ */
+typedef struct aliastab_s
+{
+	alias_t *buckets[ALIAS_HASH_SIZE];
+	size_t count;
+	unsigned long seq;
+	alias_t *retired;
+} aliastab_t;
+
+#define CMD_HASH_SIZE 64
+
+/**
+ * struct cmdhash_s - a command remembered by the command hash table
+ * @name: the command name
+ * @path: the full path of the command, NULL if it is not in PATH
+ * @hits: the number of lookups answered by this entry
+ * @next: the next entry of the same bucket
+ */
+typedef struct cmdhash_s
+{
+	char *name;
+	char *path;
+	unsigned long hits;
+	struct cmdhash_s *next;
+} cmdhash_t;
+
+/**
+ * struct pathdir_s - a PATH directory and its modification time
+ * @dir: the directory, empty for the current directory
+ * @mtime: its modification time when recorded, -1 if it was missing
+ */
+typedef struct pathdir_s
+{
+	char *dir;
+	struct timespec mtime;
+} pathdir_t;
+
+/**
+ * struct cmdtable_s - the command hash table used by find_path()
+ * @buckets: the entries, chained by the hash of their name
+ * @path: the PATH value the entries were looked up in
+ * @dirs: the directories of that PATH
+ * @ndirs: the number of directories
+ * @checked: the second of the monotonic clock in which the directories
+ *		were last checked, which stamps the whole table
+ * @hits: the number of lookups answered from the table
+ * @misses: the number of lookups that searched PATH
+ */
+typedef struct cmdtable_s
+{
+	cmdhash_t *buckets[CMD_HASH_SIZE];
+	char *path;
+	pathdir_t *dirs;
+	int ndirs;
+	time_t checked;
+	unsigned long hits;
+	unsigned long misses;
+} cmdtable_t;
+
+/**
+ * struct usage_s - the cost of a command
+ * @real: the wall clock time it took
+ * @ru: the resources used by the processes the shell waited for, and
+ *	by the shell itself when the command was timed
+ */
+typedef struct usage_s
+{
+	struct timespec real;
+	struct rusage ru;
+} usage_t;
+
+/**
+ * struct zyreq_s - a launch request sent to the zygote, followed by
+ *		the path, the arguments and the environment of the command,
+ *		each string ending in a NUL
+ * @argc: the number of arguments
+ * @envc: the number of environment strings
+ * @len: the size in bytes of the strings
+ * @fds: bit i set when the request carries the descriptor to install as i,
+ *		bit ZYGOTE_CWD when it carries the shell's working directory
+ * @pgid: the process group to join, as in struct launch_s
+ * @tty: the terminal to hand to the command's process group, -1 if none
+ * @mask: the shell's umask, which the command starts with
+ */
+typedef struct zyreq_s
+{
+	int argc;
+	int envc;
+	size_t len;
+	int fds;
+	pid_t pgid;
+	int tty;
+	mode_t mask;
+} zyreq_t;
+
+#define ZYGOTE_CWD 3 /* the descriptor after 0, 1 and 2 in a request */
+
+#define STAT_CACHE_SIZE 32
+
+/**
+ * struct statent_s - a path whose status the test builtin looked up
+ * @hash: the FNV-1a hash of the path
+ * @gen: the generation of the cache the entry was filled in
+ * @path: the path
+ * @known: bit 0 set when stat() was called, bit 1 when lstat() was
+ * @err: the errno of the failed stat() and lstat(), 0 on success
+ * @st: the results of stat() and lstat()
+ */
+typedef struct statent_s
+{
+	unsigned long hash;
+	unsigned long gen;
+	char *path;
+	int known;
+	int err[2];
+	struct stat st[2];
+} statent_t;
+
+/**
+ * struct statcache_s - the stat cache of the test builtin
+ * @gen: the current generation; entries of an older one are stale
+ * @slots: the entries, direct mapped on the hash of their path
+ */
+typedef struct statcache_s
+{
+	unsigned long gen;
+	statent_t slots[STAT_CACHE_SIZE];
+} statcache_t;
+
 /**
  * struct Shell - Structure used to store the state of the shell
  * @arg:the argument that was passed to the shell.
@@ -51,16 +480,48 @@ ssize_t find_index(list_t *, list_t *);
  * @argc: the number of arguments passed to the shell.
  * @count: the current line number of the shell input.
  * @estatus: the exit status of the last command executed by the shell.
- * @display: A flag indicating whether to display line numbers.
  * @fname: the name of the current file being executed by the shell.
- * @env: a linked list that represents the shell's environment variables.
- * @environ: An array of strings that reps the shell's environment variables.
- * @alias:  a linked list that represents the shell's alias commands.
- * @modified: A flag indicating if the env variables have been modified.
+ * @env: the shell's environment variables, a hash table.
+ * @vars: the shell variables that are not exported, a table of its own
+ *		so that setting them leaves the environment alone.
+ * @alias: the shell's aliases, a hash table allocated on first use.
  * @status: the current status of the shell.
  * @Buffer: the command buffer of the shell.
- * @type: the type of command buffer being used by the shell.
  * @file_descriptor: holds the file descriptor used for reading input.
+ * @map: the script file mapped into memory, or NULL when reading with read().
+ * @map_size: the size in bytes of the mapping.
+ * @map_pos: offset of the next unread line in the mapping.
+ * @map_tail: heap copy of a last line that has no trailing newline.
+ * @in: the line reader used when the input is read with read().
+ * @args: storage behind argv, reused from one command to the next.
+ * @arena: the memory of the current command's expansions, given back
+ *		once it is done.
+ * @scratch: the expanded words of the current command, one after
+ *		the other, reused from one command to the next.
+ * @cache: the parse cache of compiled input lines, allocated on first use.
+ * @hash: the command hash table, allocated on first use.
+ * @options: the OPT_* flags turned on with the set builtin.
+ * @jobs: the job table, in start order.
+ * @jobctl: non-zero when job control is on, in an interactive shell.
+ * @pgid: the shell's own process group.
+ * @last_bg: the pid of the last background job's last process, for $!.
+ * @redir: the redirections of the command being run, NULL if none.
+ * @stats: the stat cache of the test builtin, allocated on first use.
+ * @usage: the cost of the last foreground command, for $HSH_REAL & co.
+ * @acct: the usage the running command adds the jobs it waits for to.
+ * @zygote: the pid of the zygote process, 0 when it is not running.
+ * @zygote_fd: the shell's end of the socket to the zygote.
+ * @dirs: the directories read for pathname expansion by the command
+ *		list being run.
+ * @globs: the words of a command being expanded, then its args, which
+ *		this takes the place of, so that both are reused.
+ * @globpath: the path being matched by pathname expansion.
+ * @spare: a job done with, kept with its buffers for the next one.
+ * @cmdno: counts the commands whose expansions were given back, so that
+ *		a directory listing names the one it was last used for.
+ * @done: the finished jobs of a script whose status no wait took yet,
+ *		oldest first, allocated on first use.
+ * @ndone: the number of them.
  */
 typedef struct Shell
 {
@@ -70,25 +531,347 @@ typedef struct Shell
 	int argc;
 	unsigned int count;
 	int estatus;
-	int display;
 	char *fname;
-	list_t *env;
-	list_t *alias;
-	char **environ;
-	int modified;
+	envtab_t env;
+	envtab_t vars;
+	aliastab_t *alias;
 	int status;
 	char **Buffer;
-	int type;
 	int file_descriptor;
+	char *map;
+	size_t map_size;
+	size_t map_pos;
+	char *map_tail;
+	reader_t in;
+	strvec_t args;
+	arena_t arena;
+	strbuf_t scratch;
+	struct cached_s *cache;
+	cmdtable_t *hash;
+	int options;
+	struct job_s *jobs;
+	int jobctl;
+	pid_t pgid;
+	pid_t last_bg;
+	struct launch_s *redir;
+	statcache_t *stats;
+	usage_t usage;
+	usage_t *acct;
+	pid_t zygote;
+	int zygote_fd;
+	struct dirlist_s *dirs;
+	strvec_t globs;
+	strbuf_t globpath;
+	struct job_s *spare;
+	unsigned long cmdno;
+	struct done_s *done;
+	int ndone;
 } shell_t;
 
 /*a macro that initializes a struct of type shell with default values.*/
 #define SHELL_INIT                                  \
 	{                                            \
-		NULL, NULL, NULL, 0, 0, 0, 0, NULL, \
-		  NULL, NULL, NULL, 0, 0, NULL, 0, 0	\
+		NULL, NULL, NULL, 0, 0, 0, NULL,     \
+		  {NULL, NULL, 0, 0, 0, 0, NULL, 0},	\
+		  {NULL, NULL, 0, 0, 0, 0, NULL, 0}, NULL, 0, NULL, 0,	\
+		  NULL, 0, 0, NULL,			\
+		  {NULL, 0, 0, 0, 0, 0},		\
+		  {NULL, 0, 0}, {NULL}, {NULL, 0, 0}, NULL, NULL, 0, \
+		  NULL, 0, 0, 0, NULL, NULL,		\
+		  {{0, 0}, {{0, 0}, {0, 0}, {0}, {0}, {0}, {0}, {0},	\
+		  {0}, {0}, {0}, {0}, {0}, {0}, {0}, {0}, {0}}}, NULL,	\
+		  0, 0, NULL, {NULL, 0, 0}, {NULL, 0, 0}, NULL, 0,	\
+		  NULL, 0						\
 	}
 
+#define OPT_PIPEFAIL 1 /* set -o pipefail */
+
+/**
+ * struct dirlist_s - the names in a directory, as read for pathname
+ *		expansion
+ * @dev: the device of the directory
+ * @ino: its inode
+ * @mtime: its modification time when it was read
+ * @racy: non-zero when the listing is not to be reused, as the directory
+ *		was modified too recently for its mtime to tell
+ * @stale: non-zero when the listing was read for an earlier command list:
+ *		it is to be read again, and its buffers may be reused for
+ *		another directory
+ * @cmdno: the command that last used the listing: while it runs, its
+ *		words point into the listing, which is not read again
+ * @blob: the names, one after the other, each terminated
+ * @types: the type of each name, as readdir() tells it
+ * @names: the names, pointing into blob
+ * @next: the next directory of the cache
+ */
+typedef struct dirlist_s
+{
+	dev_t dev;
+	ino_t ino;
+	struct timespec mtime;
+	int racy;
+	int stale;
+	unsigned long cmdno;
+	strbuf_t blob;
+	strbuf_t types;
+	strvec_t names;
+	struct dirlist_s *next;
+} dirlist_t;
+
+#define WALK_MAX_THREADS 64
+#define WALK_BUF_SIZE 32768
+#define WALK_LOAD(x) __sync_add_and_fetch(&(x), 0) /* an atomic read */
+
+/**
+ * struct walkq_s - a worker of a directory tree walk and its deque of
+ *		directories to read: the worker takes the newest, and the
+ *		other workers steal the oldest when they run out
+ * @lock: guards the deque
+ * @v: the directories, as paths ending with '/'
+ * @head: the index of the oldest directory
+ * @len: the index past the newest directory
+ * @cap: the number of allocated directories
+ * @found: the paths the worker matched
+ * @arena: the memory of the paths the worker queued or matched
+ * @walk: the walk the worker is part of
+ */
+typedef struct walkq_s
+{
+	pthread_mutex_t lock;
+	char **v;
+	size_t head;
+	size_t len;
+	size_t cap;
+	strvec_t found;
+	arena_t arena;
+	struct walk_s *walk;
+} walkq_t;
+
+/**
+ * struct walk_s - a directory tree walk for a ** pattern
+ * @rootfd: the directory the walk starts at, which the others are opened
+ *		relative to
+ * @base: the length of its path, with which every path starts
+ * @pat: the component the names are matched against, "" to keep every
+ *		name, NULL to keep the directories, with a trailing '/'
+ * @q: the workers
+ * @n: the number of workers
+ * @pending: the directories queued or being read
+ * @queued: the directories queued
+ * @idle: the workers waiting for a directory to be queued
+ * @error: set when memory ran out
+ * @lock: guards the waiting
+ * @cond: signaled when directories are queued, or when none are pending
+ */
+typedef struct walk_s
+{
+	int rootfd;
+	size_t base;
+	char *pat;
+	walkq_t *q;
+	int n;
+	volatile long pending;
+	volatile long queued;
+	volatile long idle;
+	volatile int error;
+	pthread_mutex_t lock;
+	pthread_cond_t cond;
+} walk_t;
+
+/**
+ * struct launch_s - the standard file descriptors of a child process
+ * @fd: the descriptors to install as 0, 1 and 2, -1 to inherit one
+ * @spare: a descriptor only the shell needs, -1 if none
+ * @own: the descriptors opened for redirections, -1 for a free slot
+ * @pgid: the process group to join, 0 to lead a new one,
+ *	-1 to stay in the shell's
+ * @tty: the terminal to hand to the child's process group, -1 if none
+ */
+typedef struct launch_s
+{
+	int fd[3];
+	int spare;
+	int own[3];
+	pid_t pgid;
+	int tty;
+} launch_t;
+
+#define PROC_RUNNING 0
+#define PROC_STOPPED 1
+#define PROC_DONE 2
+
+/**
+ * struct proc_s - one process of a job
+ * @pid: the process id, -1 if the command could not be started
+ * @state: one of the PROC_* values
+ * @status: the exit status, once the process is done
+ */
+typedef struct proc_s
+{
+	pid_t pid;
+	int state;
+	int status;
+} proc_t;
+
+/**
+ * struct job_s - a pipeline started by the shell
+ * @id: the job number, as used by %n
+ * @pgid: the job's process group, 0 without job control
+ * @n: the number of processes
+ * @cap: the number of processes allocated
+ * @procs: the processes, in pipeline order
+ * @text: the pipeline's command line, as shown by jobs
+ * @textcap: the number of bytes allocated for the text
+ * @notify: non-zero when the job changed state since it was last shown
+ * @ru: the resources used by the processes of the job that are done
+ * @next: the next job, in start order
+ */
+typedef struct job_s
+{
+	int id;
+	pid_t pgid;
+	int n;
+	int cap;
+	proc_t *procs;
+	char *text;
+	size_t textcap;
+	int notify;
+	struct rusage ru;
+	struct job_s *next;
+} job_t;
+
+#define JOBS_DONE_MAX 1024 /* the finished jobs a script remembers */
+
+/**
+ * struct done_s - a finished job of a script, gone from the job table
+ *		but kept for wait, which POSIX has remember its status
+ * @pid: the pid of its last process, as $! gave it
+ * @id: its job number, as used by %n
+ * @status: the status of its last command
+ * @failed: the status of its rightmost command that failed, taken with
+ *		pipefail on
+ */
+typedef struct done_s
+{
+	pid_t pid;
+	int id;
+	int status;
+	int failed;
+} done_t;
+
+#define RUN_ALWAYS 0 /* first command of a line or after ';' */
+#define RUN_IF_OK 1 /* after '&&' */
+#define RUN_IF_FAIL 2 /* after '||' */
+#define RUN_PIPED 3 /* after '|': reads the previous command's output */
+#define RUN_ASYNC 4 /* '&': runs the pipeline before it in the background */
+
+/**
+ * struct insn_s - one instruction of a compiled program
+ * @cond: when the command runs, one of the RUN_* values
+ * @argv: index of the command's first word in the program's word pool
+ * @argc: the number of words of the command
+ * @vars: non-zero when one of the words refers to a variable
+ * @async: non-zero when the pipeline ending here runs in the background
+ * @timed: non-zero when the pipeline starting here is prefixed by time
+ * @redir: index of the command's first redirection in the program
+ * @nredir: the number of redirections of the command
+ * @line: the script line the command was read from, 0 for the current one
+ *
+ * An instruction without words is a syntax error; its only word slot
+ * holds the unexpected token, or NULL for an unexpected end of line.
+ */
+typedef struct insn_s
+{
+	int cond;
+	size_t argv;
+	int argc;
+	int vars;
+	int async;
+	int timed;
+	size_t redir;
+	int nredir;
+	unsigned int line;
+} insn_t;
+
+#define REDIR_IN 0 /* < */
+#define REDIR_OUT 1 /* > */
+#define REDIR_APPEND 2 /* >> */
+#define REDIR_DUP 3 /* >& and <& */
+
+/**
+ * struct redir_s - one redirection of a compiled command
+ * @fd: the descriptor redirected
+ * @op: one of the REDIR_* values
+ * @target: the file name, or the descriptor copied by REDIR_DUP
+ */
+typedef struct redir_s
+{
+	int fd;
+	int op;
+	char *target;
+} redir_t;
+
+/**
+ * struct program_s - a script compiled once into an instruction array
+ * @code: the instructions, in execution order
+ * @len: the number of instructions
+ * @cap: the number of allocated instructions
+ * @words: the word pool, each command's words followed by a NULL
+ * @text: copies of the lines the words point into, when the script
+ *	is not mapped
+ * @redirs: the redirections of every command, in order
+ * @nredirs: the number of redirections
+ * @redir_cap: the number of allocated redirections
+ */
+typedef struct program_s
+{
+	insn_t *code;
+	size_t len;
+	size_t cap;
+	strvec_t words;
+	strvec_t text;
+	redir_t *redirs;
+	size_t nredirs;
+	size_t redir_cap;
+} program_t;
+
+#define PARSE_CACHE_SIZE 64
+
+/**
+ * struct cached_s - a compiled input line kept in the parse cache
+ * @hash: the FNV-1a hash of the line
+ * @len: the length of the line
+ * @line: the line as it was read
+ * @prog: the compiled line, whose words point into a copy of the line
+ */
+typedef struct cached_s
+{
+	unsigned long hash;
+	size_t len;
+	char *line;
+	program_t prog;
+} cached_t;
+
+#define TEST_UNARY 1
+#define TEST_BINARY 2
+
+/**
+ * struct test_s - the state of the test builtin's expression parser
+ * @data: the shell, for error messages and the stat cache
+ * @argv: the operands of the expression
+ * @argc: the number of operands, without a closing "]"
+ * @i: index of the next operand to parse
+ * @error: non-zero once an error was reported
+ */
+typedef struct test_s
+{
+	shell_t *data;
+	char **argv;
+	int argc;
+	int i;
+	int error;
+} test_t;
+
 /**
  * struct builtin - contains a builtin string and related function
  * @type: the builtin command flag
@@ -108,14 +891,55 @@ int env_builtin(shell_t *);
 int setenv_builtin(shell_t *);
 int unsetenv_builtin(shell_t *);
 int alias_builtin(shell_t *);
+int hash_builtin(shell_t *);
+int echo_builtin(shell_t *);
+int pwd_builtin(shell_t *);
+int true_builtin(shell_t *);
+int false_builtin(shell_t *);
+int printf_builtin(shell_t *);
+int printf_format(shell_t *, char *, char ***, int *);
+int printf_conv(shell_t *, char *, char ***, int *);
+int printf_width(char *, int, char *, int *, char ***);
+void printf_value(shell_t *, char *, int, char *, int *);
+int put_escape(char *, int, int *);
+long printf_number(shell_t *, char *, int *);
+int print_hash(shell_t *, int);
+int test_builtin(shell_t *);
+int time_builtin(shell_t *);
+size_t is_assignment(char *);
+int assign_builtin(shell_t *);
+int set_var(shell_t *, char *);
+int export_builtin(shell_t *);
+int unset_builtin(shell_t *);
+int test_list(test_t *, char *);
+int test_not(test_t *);
+int test_primary(test_t *);
+int test_error(test_t *, char *, char *);
+int test_op(char *);
+int test_unary(test_t *, char *, char *);
+int test_binary(test_t *, char *, char *, char *);
+int test_files(test_t *, char *, char *, char *);
+long test_number(test_t *, char *);
 
 int set_alias(shell_t *, char *);
 int unset_alias(shell_t *, char *);
 int replace_alias(shell_t *);
-int print_alias(list_t *node);
+int print_alias(alias_t *);
+void alias_free(alias_t *);
+alias_t *alias_get(shell_t *, char *, size_t);
+int alias_expand(shell_t *, int, int *);
+int alias_splice(shell_t *, int, alias_t *);
+int alias_list(shell_t *);
+void free_aliases(shell_t *);
+void free_retired(shell_t *);
+char *alias_quoted(shell_t *, int *);
 int execute(shell_t *, char **);
 int replace_vars(shell_t *);
-int strep(char **, char *);
+int expand_word(shell_t *, char *);
+size_t param_name(char *, char **);
+int expand_param(shell_t *, char *, size_t);
+int strbuf_number(strbuf_t *, long);
+int strbuf_add(strbuf_t *, const char *, size_t);
 char *_itoa(long int, int, int);
 int interactive(shell_t *);
 int populate(shell_t *);
@@ -126,18 +950,61 @@ int _strcmp(char *, char *);
 char *_strchr(char *, char);
 char *_strcat(char *, char *);
 char *_strcpy(char *, char *);
-char *_strdup(const char *);
+char *_strdup_at(const char *, const char *);
 char *_strncpy(char *, char *, int);
 char *_strncat(char *, char *, int);
-char **strtow(char *, char *);
+int tokenize(char *, const unsigned char *, strvec_t *);
+int strvec_push(strvec_t *, char *);
+void strvec_clear(strvec_t *);
+void strvec_free(strvec_t *);
 char *_strstr(const char *, const char *);
-char **expand_wildcards(char *);
-void execute_wildcard(shell_t *);
+void str_init(void);
+void *arena_alloc(arena_t *, size_t);
+char *arena_strndup(arena_t *, const char *, size_t);
+void arena_adopt(arena_t *, arena_t *);
+void arena_reset(arena_t *);
+void arena_free(arena_t *);
+size_t str_len_word(const char *);
+const char *str_chr_word(const char *, int);
+size_t str_cmp_word(const char *, const char *);
+size_t str_len_sse2(const char *);
+const char *str_chr_sse2(const char *, int);
+size_t str_cmp_sse2(const char *, const char *);
+size_t str_len_avx2(const char *);
+const char *str_chr_avx2(const char *, int);
+size_t str_cmp_avx2(const char *, const char *);
+int expand_globs(shell_t *);
+int glob_word(shell_t *, char *, strbuf_t *, strvec_t *);
+int glob_walk(shell_t *, strbuf_t *, char *, strvec_t *);
+int glob_entries(shell_t *, strbuf_t *, char *, strvec_t *);
+int glob_push(shell_t *, strbuf_t *, char *, strvec_t *);
+int glob_meta(char *, int);
+int glob_match(char *, char *);
+int glob_one(char **, char);
+int glob_class(char *, char, char **);
+int glob_compare(const void *, const void *);
+dirlist_t *dir_list(shell_t *, char *);
+int dir_read(dirlist_t *, char *);
+void dir_cache_flush(shell_t *);
+void free_dir_cache(shell_t *);
+int glob_star(shell_t *, strbuf_t *, char *, strvec_t *);
+int glob_keep(strvec_t *, strvec_t *);
+int walk_tree(shell_t *, strbuf_t *, char *, strvec_t *);
+int walk_threads(shell_t *);
+int walk_merge(walk_t *, arena_t *, strvec_t *);
+void *walk_worker(void *);
+char *walk_next(walkq_t *);
+void walk_dir(walkq_t *, char *);
+int walk_entry(walkq_t *, int, char *, char *, int, strvec_t *);
+int walk_push(walkq_t *, char **, size_t);
 void _puts(char *);
 int _putchar(char);
 int _puts2(char);
 void _eputs(char *);
-int _write(char, int);
+void flush_output(shell_t *);
+int out_write(int, const char *, size_t);
+int out_flush(int);
+int out_drain(int, struct iovec *, int);
 void _perror(shell_t *, char *);
 int decimal(int, int);
 void _free(char **);
@@ -147,22 +1014,148 @@ void clear_data(shell_t *);
 void free_data(shell_t *, int);
 int _free2(void **);
 ssize_t get_input(shell_t *);
-int chained(shell_t *, char *, size_t *);
-void check_chain(shell_t *, char *, size_t *, size_t, size_t);
-ssize_t read_buffer(shell_t *data, char *buffer, size_t *i);
-void set_data(shell_t *, char **);
+ssize_t read_buffer(shell_t *, reader_t *);
+size_t read_block_size(int);
+void free_reader(reader_t *);
 int find_builtin(shell_t *);
+int run_builtin(shell_t *, builtin_t *);
 void parse_command(shell_t *);
 void _forks(shell_t *);
+job_t *job_new(shell_t *, int);
+int job_text(job_t *, char **);
+void job_free(shell_t *, job_t *);
+job_t *find_job(shell_t *, char *);
+int job_state(job_t *);
+void job_retire(shell_t *, job_t *);
+int job_recall(shell_t *, char *);
+int job_done_id(shell_t *);
+void free_done(shell_t *);
+void job_launch(shell_t *, job_t *, launch_t *, int);
+void job_started(shell_t *, job_t *, int, pid_t);
+int job_finish(shell_t *, job_t *, int);
+int wait_job(shell_t *, job_t *);
+void init_job_control(shell_t *);
+void sigchld_handler(int);
+void reap_jobs(shell_t *);
+void proc_update(job_t *, proc_t *, int, struct rusage *);
+job_t *wait_jobs(shell_t *, job_t *, int);
+void notify_jobs(shell_t *);
+int jobs_builtin(shell_t *);
+int wait_builtin(shell_t *);
+int fg_builtin(shell_t *);
+int bg_builtin(shell_t *);
+int wait_all(shell_t *, int);
+int wait_one(shell_t *, char *);
+job_t *control_job(shell_t *);
+void print_job(shell_t *, job_t *, int);
+int jobs_running(shell_t *);
+void posix_launch(launch_t *, posix_spawn_file_actions_t *,
+		posix_spawnattr_t *);
+pid_t spawn_command(shell_t *, launch_t *, int *);
+int spawn_backend(shell_t *);
+pid_t spawn_fork(shell_t *, char **, launch_t *, int *);
+pid_t spawn_vfork(shell_t *, char **, launch_t *, int *);
+pid_t spawn_posix(shell_t *, char **, launch_t *, int *);
+int resolve_command(shell_t *);
+void spawn_failed(shell_t *, int);
+int child_status(int);
+int make_pipe(int *, int);
+int job_status(shell_t *, job_t *);
+int run_pipeline(shell_t *, program_t *, insn_t *, int);
+pid_t run_stage(shell_t *, program_t *, insn_t *, launch_t *);
+pid_t fork_builtin(shell_t *, builtin_t *, launch_t *);
+void apply_launch(launch_t *);
+builtin_t *lookup_builtin(char *);
+int set_builtin(shell_t *);
+int print_options(shell_t *);
 char **get_environ(shell_t *);
+void env_free(envtab_t *);
+unsigned long env_hash(const char *, size_t);
+size_t env_probe(envtab_t *, const char *, size_t, unsigned long);
+int env_put(envtab_t *, char *);
+int env_remove(envtab_t *, const char *, size_t);
+int env_rehash(envtab_t *);
+void env_compact(envtab_t *);
 int iscommand(shell_t *, char *);
 char *find_path(shell_t *, char *, char *);
 char *duplicates(char *, int, int);
+char *hash_lookup(shell_t *, char *, char *);
+int hash_set_path(cmdtable_t *, char *);
+int hash_dirs_changed(cmdtable_t *);
+cmdhash_t *hash_search(shell_t *, cmdtable_t *, char *, cmdhash_t *);
+void hash_flush(cmdtable_t *, int);
 int _getline(shell_t *, char **, size_t *);
+int map_script(shell_t *);
+int map_getline(shell_t *, char **, size_t *);
+void release_line(shell_t *, char **);
+void unmap_script(shell_t *);
 void *_realloc(void *, unsigned int, unsigned int);
 char *_getenv(shell_t *, const char *);
+char *env_value(envtab_t *, const char *, size_t);
 int _unsetenv(shell_t *, char *);
 int _setenv(shell_t *, char *, char *);
 int _atoi(char *);
+int compile_script(shell_t *, program_t *);
+int compile_line(program_t *, char *, unsigned int);
+int list_operator(char *, size_t *, char **);
+int emit_error(program_t *, char *, unsigned int);
+int emit_command(program_t *, char *, int, unsigned int);
+int program_reserve(program_t *);
+int emit_redirs(program_t *, size_t, insn_t *);
+int parse_redir(char *, redir_t *);
+int redir_push(program_t *, redir_t *);
+char *redir_target(shell_t *, redir_t *);
+void launch_init(launch_t *);
+int swap_fds(launch_t *, int *);
+void restore_fds(int *);
+int open_redirs(shell_t *, program_t *, insn_t *, launch_t *);
+int redir_source(shell_t *, redir_t *, launch_t *, int *);
+void redir_install(launch_t *, int, int, int);
+void close_redirs(launch_t *);
+int redir_error(shell_t *, char *, char *, int);
+void free_program(program_t *);
+int execute_script(shell_t *, char **);
+int run_program(shell_t *, program_t *, char **);
+int run_insn(shell_t *, program_t *, insn_t *);
+int load_insn(shell_t *, program_t *, insn_t *);
+int syntax_error(shell_t *, char *);
+int run_line(shell_t *, char **);
+cached_t *cache_lookup(shell_t *, char *);
+cached_t *cache_fill(cached_t *, char *);
+unsigned long hash_line(const char *, size_t *);
+void free_parse_cache(shell_t *);
+struct stat *cached_stat(shell_t *, char *, int);
+void stat_cache_flush(shell_t *);
+void free_stat_cache(shell_t *);
+int run_measured(shell_t *, program_t *, insn_t *, int);
+void usage_done(shell_t *, usage_t *, usage_t *, int);
+void usage_add(struct rusage *, struct rusage *);
+void time_report(usage_t *);
+int usage_var(shell_t *, char *, size_t, strbuf_t *);
+void emit_time(program_t *, insn_t *);
+int zygote_start(shell_t *);
+pid_t spawn_zygote(shell_t *, char **, launch_t *, int *);
+void zygote_stop(shell_t *);
+int zygote_send(shell_t *, char **, launch_t *);
+int zygote_msg(int, zyreq_t *, launch_t *, int);
+int io_full(int, void *, size_t, int);
+void zygote_serve(int);
+int zygote_recv(int, zyreq_t *, int *, char **);
+void zygote_launch(zyreq_t *, int *, char *, int *);
+void zygote_exec(zyreq_t *, int *, char *, int);
+void mem_init(void);
+void *mem_malloc(size_t, const char *);
+void *mem_calloc(size_t, size_t, const char *);
+void *mem_realloc(void *, size_t, const char *);
+void mem_free(void *);
+memsite_t *mem_site(const char *);
+memobj_t *mem_slot(void *, memobj_t **);
+void mem_track(void *, size_t, const char *);
+void mem_untrack(memobj_t *);
+int mem_grow(void);
+int memstats_builtin(shell_t *);
+void mem_print(int, void (*)(char *));
+int mem_compare(const void *, const void *);
+void mem_report(void);
 
 #endif
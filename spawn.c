@@ -0,0 +1,174 @@
+#include "shell.h"
+
+pid_t spawn_command(shell_t *, launch_t *, int *);
+pid_t spawn_fork(shell_t *, char **, launch_t *, int *);
+pid_t spawn_vfork(shell_t *, char **, launch_t *, int *);
+pid_t spawn_posix(shell_t *, char **, launch_t *, int *);
+void posix_launch(launch_t *, posix_spawn_file_actions_t *,
+		posix_spawnattr_t *);
+
+/**
+ * spawn_command - starts data->path with data->argv in a child process,
+ *		using the backend picked by the HSH_SPAWN variable.
+ * The child may change any file, so the stat cache is flushed.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * @launch: the child's standard file descriptors, NULL to inherit them.
+ * @err: receives the errno of a failed spawn, or of a failed execve()
+ *		when the backend can report it.
+ * Return: the child's pid, or -1 if no child is left to wait for.
+ */
+pid_t spawn_command(shell_t *data, launch_t *launch, int *err)
+{
+	char **envp = get_environ(data);
+
+	*err = 0;
+	_putchar(BUF_FLUSH); /* builtin output goes out before the child's */
+	stat_cache_flush(data);
+	switch (spawn_backend(data))
+	{
+	case SPAWN_FORK:
+		return (spawn_fork(data, envp, launch, err));
+	case SPAWN_VFORK:
+		return (spawn_vfork(data, envp, launch, err));
+	case SPAWN_ZYGOTE:
+		return (spawn_zygote(data, envp, launch, err));
+	default:
+		return (spawn_posix(data, envp, launch, err));
+	}
+}
+
+/**
+ * spawn_fork - the fork() backend: copies the whole shell, then execs.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * @envp: the environment of the command.
+ * @launch: the child's standard file descriptors, or NULL.
+ * @err: receives the errno of a failed fork().
+ * Return: the child's pid, or -1 on failure.
+ */
+pid_t spawn_fork(shell_t *data, char **envp, launch_t *launch, int *err)
+{
+	pid_t child_pid = fork();
+
+	if (child_pid == 0)
+	{
+		apply_launch(launch);
+		if (execve(data->path, data->argv, envp) == -1)
+		{
+			if (errno == EACCES)
+			{
+				_perror(data, "Permission denied\n");
+				free_data(data, 1);
+				exit(126);
+			}
+			free_data(data, 1);
+			exit(1);
+		}
+	}
+	if (child_pid == -1)
+		*err = errno;
+	return (child_pid);
+}
+
+/**
+ * spawn_vfork - the vfork() backend: the child borrows the shell's memory
+ *		until it execs, so no page tables are copied.
+ * The child only calls execve() and _exit(), and hands the errno of a
+ *		failed execve() back through the shared memory.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * @envp: the environment of the command.
+ * @launch: the child's standard file descriptors, or NULL.
+ * @err: receives the errno of a failed execve().
+ * Return: the child's pid, or -1 on failure.
+ */
+pid_t spawn_vfork(shell_t *data, char **envp, launch_t *launch, int *err)
+{
+	volatile int exec_errno = 0;
+	pid_t child_pid = vfork();
+
+	if (child_pid == 0)
+	{
+		apply_launch(launch);
+		execve(data->path, data->argv, envp);
+		exec_errno = errno;
+		_exit(exec_errno == EACCES ? 126 : 1);
+	}
+	if (child_pid == -1)
+		*err = errno;
+	else if (exec_errno)
+	{
+		waitpid(child_pid, NULL, 0);
+		*err = exec_errno;
+		return (-1);
+	}
+	return (child_pid);
+}
+
+/**
+ * spawn_posix - the posix_spawn() backend.
+ * The C library reports a failed exec as the spawn's return value,
+ *		in which case there is no child to wait for.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * @envp: the environment of the command.
+ * @launch: the child's standard file descriptors, or NULL.
+ * @err: receives the error of a failed spawn or exec.
+ * Return: the child's pid, or -1 on failure.
+ */
+pid_t spawn_posix(shell_t *data, char **envp, launch_t *launch, int *err)
+{
+	posix_spawn_file_actions_t fa;
+	posix_spawnattr_t attr;
+	pid_t child_pid;
+
+	posix_spawn_file_actions_init(&fa);
+	posix_spawnattr_init(&attr);
+	posix_launch(launch, &fa, &attr);
+	*err = posix_spawn(&child_pid, data->path, &fa, &attr,
+			data->argv, envp);
+	posix_spawnattr_destroy(&attr);
+	posix_spawn_file_actions_destroy(&fa);
+	return (*err ? -1 : child_pid);
+}
+
+/**
+ * posix_launch - turns a launch into posix_spawn() file actions and
+ *		attributes: the process group, the terminal, the stop
+ *		signals the shell ignores put back to their default,
+ *		and the standard file descriptors.
+ * @launch: the child's launch, or NULL.
+ * @fa: the file actions to fill.
+ * @attr: the attributes to fill.
+ */
+void posix_launch(launch_t *launch, posix_spawn_file_actions_t *fa,
+		posix_spawnattr_t *attr)
+{
+	sigset_t defaults;
+	int fd;
+
+	if (launch && launch->pgid != -1)
+	{
+		sigemptyset(&defaults);
+		sigaddset(&defaults, SIGTSTP);
+		sigaddset(&defaults, SIGTTIN);
+		sigaddset(&defaults, SIGTTOU);
+		sigaddset(&defaults, SIGQUIT);
+		posix_spawnattr_setsigdefault(attr, &defaults);
+		posix_spawnattr_setpgroup(attr, launch->pgid);
+		posix_spawnattr_setflags(attr,
+				POSIX_SPAWN_SETPGROUP | POSIX_SPAWN_SETSIGDEF);
+#ifdef __GLIBC_PREREQ
+#if __GLIBC_PREREQ(2, 35)
+		if (launch->tty != -1)
+			posix_spawn_file_actions_addtcsetpgrp_np(fa,
+					launch->tty);
+#endif
+#endif
+	}
+	for (fd = 0; launch && fd < 3; fd++)
+		if (launch->fd[fd] != -1)
+			posix_spawn_file_actions_adddup2(fa,
+					launch->fd[fd], fd);
+}
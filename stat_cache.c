@@ -0,0 +1,87 @@
+#include "shell.h"
+
+struct stat *cached_stat(shell_t *, char *, int);
+void stat_cache_flush(shell_t *);
+void free_stat_cache(shell_t *);
+
+/**
+ * cached_stat - looks up the status of a path for the test builtin,
+ *		calling stat() or lstat() only the first time the path is
+ *		asked about since the cache was last flushed.
+ * The cache is direct mapped on the path's hash. It is not used while
+ *		jobs are running in the background, as they may change the
+ *		file system at any time.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * @path: the path.
+ * @link: non-zero to not follow a final symbolic link.
+ * Return: the status, valid until the next lookup, or NULL with errno set.
+ */
+struct stat *cached_stat(shell_t *data, char *path, int link)
+{
+	static statent_t uncached;
+	size_t len;
+	unsigned long hash = hash_line(path, &len);
+	statent_t *e = &uncached;
+	int running = jobs_running(data);
+
+	if (!data->stats && !running)
+	{
+		data->stats = calloc(1, sizeof(statcache_t));
+		if (data->stats)
+			data->stats->gen = 1; /* the zeroed slots are stale */
+	}
+	if (data->stats && !running)
+		e = &data->stats->slots[hash % STAT_CACHE_SIZE];
+	if (e != &uncached && (e->gen != data->stats->gen ||
+			e->hash != hash || !e->path || _strcmp(e->path, path)))
+	{
+		free(e->path);
+		e->path = _strdup(path);
+		e->hash = hash;
+		e->gen = data->stats->gen;
+		e->known = 0;
+		if (!e->path)
+			e = &uncached;
+	}
+	if (e == &uncached)
+		e->known = 0;
+	if (!(e->known & (1 << link)))
+	{
+		e->err[link] = (link ? lstat(path, &e->st[link]) :
+				stat(path, &e->st[link])) ? errno : 0;
+		e->known |= 1 << link;
+	}
+	errno = e->err[link];
+	return (e->err[link] ? NULL : &e->st[link]);
+}
+
+/**
+ * stat_cache_flush - forgets every status in the stat cache, when the
+ *		shell runs something that may change the file system or
+ *		what relative paths point to.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ */
+void stat_cache_flush(shell_t *data)
+{
+	if (data->stats)
+		data->stats->gen++;
+}
+
+/**
+ * free_stat_cache - frees the stat cache.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ */
+void free_stat_cache(shell_t *data)
+{
+	int i;
+
+	if (!data->stats)
+		return;
+	for (i = 0; i < STAT_CACHE_SIZE; i++)
+		free(data->stats->slots[i].path);
+	free(data->stats);
+	data->stats = NULL;
+}
@@ -0,0 +1,93 @@
+#include "shell.h"
+#ifdef __SSE2__
+#include <immintrin.h>
+
+size_t str_len_avx2(const char *);
+const char *str_chr_avx2(const char *, int);
+size_t str_cmp_avx2(const char *, const char *);
+
+/**
+ * str_len_avx2 - str_len_sse2(), 32 bytes at a time.
+ * @s: the string.
+ * Return: its length.
+ */
+STR_SCAN STR_AVX2 size_t str_len_avx2(const char *s)
+{
+	const char *p = (const char *)((size_t)s & ~(size_t)31);
+	__m256i zero = _mm256_setzero_si256();
+	unsigned int m;
+
+	m = _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_load_si256(
+					(const __m256i *)p), zero)) >> (s - p);
+	if (m)
+		return (__builtin_ctz(m));
+	do {
+		p += 32;
+		m = _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_load_si256(
+						(const __m256i *)p), zero));
+	} while (!m);
+	return (p + __builtin_ctz(m) - s);
+}
+
+/**
+ * str_chr_avx2 - str_chr_sse2(), 32 bytes at a time.
+ * @s: the string.
+ * @c: the character.
+ * Return: its first occurrence, or else the string's terminating '\0'.
+ */
+STR_SCAN STR_AVX2 const char *str_chr_avx2(const char *s, int c)
+{
+	const char *p = (const char *)((size_t)s & ~(size_t)31);
+	__m256i zero = _mm256_setzero_si256(), cv, v;
+	unsigned int m;
+
+	cv = _mm256_set1_epi8((char)c);
+	v = _mm256_load_si256((const __m256i *)p);
+	v = _mm256_or_si256(_mm256_cmpeq_epi8(v, zero),
+			_mm256_cmpeq_epi8(v, cv));
+	m = _mm256_movemask_epi8(v) >> (s - p);
+	if (m)
+		return (s + __builtin_ctz(m));
+	do {
+		p += 32;
+		v = _mm256_load_si256((const __m256i *)p);
+		v = _mm256_or_si256(_mm256_cmpeq_epi8(v, zero),
+				_mm256_cmpeq_epi8(v, cv));
+		m = _mm256_movemask_epi8(v);
+	} while (!m);
+	return (p + __builtin_ctz(m));
+}
+
+/**
+ * str_cmp_avx2 - str_cmp_sse2(), 32 bytes at a time.
+ * @a: the first string.
+ * @b: the second string.
+ * Return: the index of the first character that differs, or of the end
+ *		of both.
+ */
+STR_SCAN STR_AVX2 size_t str_cmp_avx2(const char *a, const char *b)
+{
+	__m256i zero = _mm256_setzero_si256(), va, vb;
+	size_t i = 0;
+	unsigned int m;
+
+	while (1)
+	{
+		if ((size_t)(a + i) % STR_PAGE > STR_PAGE - 32 ||
+				(size_t)(b + i) % STR_PAGE > STR_PAGE - 32)
+		{
+			if (a[i] != b[i] || !a[i])
+				return (i);
+			i++;
+			continue;
+		}
+		va = _mm256_loadu_si256((const __m256i *)(a + i));
+		vb = _mm256_loadu_si256((const __m256i *)(b + i));
+		m = _mm256_movemask_epi8(_mm256_cmpeq_epi8(va, vb));
+		m = ~m | _mm256_movemask_epi8(_mm256_cmpeq_epi8(va, zero));
+		if (m)
+			return (i + __builtin_ctz(m));
+		i += 32;
+	}
+}
+#endif
@@ -0,0 +1,100 @@
+#include "shell.h"
+#ifdef __SSE2__
+#include <emmintrin.h>
+
+size_t str_len_sse2(const char *);
+const char *str_chr_sse2(const char *, int);
+size_t str_cmp_sse2(const char *, const char *);
+
+/**
+ * str_len_sse2 - returns the length of a string, looking for its end
+ *		16 aligned bytes at a time.
+ * The bytes before the string in its first block are shifted out of
+ *		the mask.
+ * @s: the string.
+ * Return: its length.
+ */
+STR_SCAN size_t str_len_sse2(const char *s)
+{
+	const char *p = (const char *)((size_t)s & ~(size_t)15);
+	__m128i zero = _mm_setzero_si128();
+	unsigned int m;
+
+	m = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_load_si128(
+					(const __m128i *)p), zero)) >> (s - p);
+	if (m)
+		return (__builtin_ctz(m));
+	do {
+		p += 16;
+		m = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_load_si128(
+						(const __m128i *)p), zero));
+	} while (!m);
+	return (p + __builtin_ctz(m) - s);
+}
+
+/**
+ * str_chr_sse2 - looks for a character in a string 16 aligned bytes at
+ *		a time.
+ * @s: the string.
+ * @c: the character.
+ * Return: its first occurrence, or else the string's terminating '\0'.
+ */
+STR_SCAN const char *str_chr_sse2(const char *s, int c)
+{
+	const char *p = (const char *)((size_t)s & ~(size_t)15);
+	__m128i zero = _mm_setzero_si128(), cv, v;
+	unsigned int m;
+
+	cv = _mm_set1_epi8((char)c);
+	v = _mm_load_si128((const __m128i *)p);
+	v = _mm_or_si128(_mm_cmpeq_epi8(v, zero),
+			_mm_cmpeq_epi8(v, cv));
+	m = _mm_movemask_epi8(v) >> (s - p);
+	if (m)
+		return (s + __builtin_ctz(m));
+	do {
+		p += 16;
+		v = _mm_load_si128((const __m128i *)p);
+		v = _mm_or_si128(_mm_cmpeq_epi8(v, zero),
+				_mm_cmpeq_epi8(v, cv));
+		m = _mm_movemask_epi8(v);
+	} while (!m);
+	return (p + __builtin_ctz(m));
+}
+
+/**
+ * str_cmp_sse2 - looks for the first difference between two strings,
+ *		16 bytes at a time.
+ * The strings are not aligned alike in general, so a block that would
+ *		cross into the next page of either is compared bytewise.
+ * @a: the first string.
+ * @b: the second string.
+ * Return: the index of the first character that differs, or of the end
+ *		of both.
+ */
+STR_SCAN size_t str_cmp_sse2(const char *a, const char *b)
+{
+	__m128i zero = _mm_setzero_si128(), va, vb;
+	size_t i = 0;
+	unsigned int m;
+
+	while (1)
+	{
+		if ((size_t)(a + i) % STR_PAGE > STR_PAGE - 16 ||
+				(size_t)(b + i) % STR_PAGE > STR_PAGE - 16)
+		{
+			if (a[i] != b[i] || !a[i])
+				return (i);
+			i++;
+			continue;
+		}
+		va = _mm_loadu_si128((const __m128i *)(a + i));
+		vb = _mm_loadu_si128((const __m128i *)(b + i));
+		m = _mm_movemask_epi8(_mm_cmpeq_epi8(va, vb));
+		m = (~m & 0xFFFF) | _mm_movemask_epi8(_mm_cmpeq_epi8(va, zero));
+		if (m)
+			return (i + __builtin_ctz(m));
+		i += 16;
+	}
+}
+#endif
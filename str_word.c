@@ -0,0 +1,103 @@
+#include "shell.h"
+
+void str_init(void);
+size_t str_len_word(const char *);
+const char *str_chr_word(const char *, int);
+size_t str_cmp_word(const char *, const char *);
+
+#ifdef __SSE2__
+strops_t str_ops = {str_len_sse2, str_chr_sse2, str_cmp_sse2};
+#else
+strops_t str_ops = {str_len_word, str_chr_word, str_cmp_word};
+#endif
+
+/**
+ * str_init - picks the string scanners for the processor the shell runs
+ *		on: those using AVX2 if it has it, or else those the shell was
+ *		built with, SSE2 on x86-64, or else the word at a time ones.
+ */
+void str_init(void)
+{
+#ifdef __SSE2__
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx2"))
+	{
+		str_ops.len = str_len_avx2;
+		str_ops.chr = str_chr_avx2;
+		str_ops.cmp = str_cmp_avx2;
+	}
+#endif
+}
+
+/**
+ * str_len_word - returns the length of a string, looking for its end
+ *		one aligned word at a time.
+ * @s: the string.
+ * Return: its length.
+ */
+STR_SCAN size_t str_len_word(const char *s)
+{
+	const char *p = s;
+	const strword_t *w;
+
+	for (; (size_t)p % sizeof(strword_t); p++)
+		if (!*p)
+			return (p - s);
+	for (w = (const strword_t *)p; !STR_HAS_ZERO(*w); w++)
+		;
+	for (p = (const char *)w; *p; p++)
+		;
+	return (p - s);
+}
+
+/**
+ * str_chr_word - looks for a character in a string one aligned word at
+ *		a time.
+ * @s: the string.
+ * @c: the character.
+ * Return: its first occurrence, or else the string's terminating '\0'.
+ */
+STR_SCAN const char *str_chr_word(const char *s, int c)
+{
+	strword_t mask = STR_ONES * (unsigned char)c;
+	const strword_t *w;
+
+	for (; (size_t)s % sizeof(strword_t); s++)
+		if (!*s || *s == (char)c)
+			return (s);
+	for (w = (const strword_t *)s;
+			!STR_HAS_ZERO(*w) && !STR_HAS_ZERO(*w ^ mask); w++)
+		;
+	for (s = (const char *)w; *s && *s != (char)c; s++)
+		;
+	return (s);
+}
+
+/**
+ * str_cmp_word - looks for the first difference between two strings,
+ *		one word at a time when they are aligned alike.
+ * @a: the first string.
+ * @b: the second string.
+ * Return: the index of the first character that differs, or of the end
+ *		of both.
+ */
+STR_SCAN size_t str_cmp_word(const char *a, const char *b)
+{
+	const strword_t *wa, *wb;
+	size_t i = 0;
+
+	if (((size_t)a ^ (size_t)b) % sizeof(strword_t) == 0)
+	{
+		for (; (size_t)(a + i) % sizeof(strword_t); i++)
+			if (a[i] != b[i] || !a[i])
+				return (i);
+		wa = (const strword_t *)(a + i);
+		wb = (const strword_t *)(b + i);
+		for (; *wa == *wb && !STR_HAS_ZERO(*wa); wa++, wb++)
+			;
+		i = (const char *)wa - a;
+	}
+	for (; a[i] == b[i] && a[i]; i++)
+		;
+	return (i);
+}
@@ -14,12 +14,8 @@ char *_strcat(char *, char *);
  */
 char *_strchr(char *s, char c)
 {
-	do {
-		if (*s == c)
-			return (s);
-	} while (*s++ != '\0');
-
-	return (NULL);
+	s = (char *)str_ops.chr(s, c);
+	return (*s == c ? s : NULL);
 }
 
 /**
@@ -29,14 +25,9 @@ char *_strchr(char *s, char c)
  */
 int _strlen(char *s)
 {
-	int i = 0;
-
 	if (!s)
 		return (0);
-
-	while (*s++)
-		i++;
-	return (i);
+	return (str_ops.len(s));
 }
 
 /**
@@ -47,17 +38,13 @@ int _strlen(char *s)
  */
 int _strcmp(char *s1, char *s2)
 {
-	while (*s1 && *s2)
-	{
-		if (*s1 != *s2)
-			return (*s1 - *s2);
-		s1++;
-		s2++;
-	}
-	if (*s1 == *s2)
+	size_t i = str_ops.cmp(s1, s2);
+
+	if (s1[i] == s2[i])
 		return (0);
-	else
-		return (*s1 < *s2 ? -1 : 1);
+	if (s1[i] && s2[i])
+		return (s1[i] - s2[i]);
+	return (s1[i] < s2[i] ? -1 : 1);
 }
 
 /**
@@ -82,12 +69,6 @@ char *_strstr(const char *haystack, const char *needle)
  */
 char *_strcat(char *dest, char *src)
 {
-	char *ret = dest;
-
-	while (*dest)
-		dest++;
-	while (*src)
-		*dest++ = *src++;
-	*dest = *src;
-	return (ret);
+	memcpy(dest + str_ops.len(dest), src, str_ops.len(src) + 1);
+	return (dest);
 }
@@ -3,8 +3,7 @@
 char *_strcpy(char *, char *);
 char *_strncat(char *, char *, int);
 char *_strncpy(char *, char *, int);
-char *_strdup(const char *);
-char **strtow(char *, char *);
+char *_strdup_at(const char *, const char *);
 
 /**
  * _strncpy - copies a string
@@ -15,25 +14,16 @@ char **strtow(char *, char *);
  */
 char *_strncpy(char *dest, char *src, int n)
 {
-	int i, j;
-	char *s = dest;
+	char *end;
+	int i;
 
-	i = 0;
-	while (src[i] != '\0' && i < n - 1)
-	{
-		dest[i] = src[i];
-		i++;
-	}
-	if (i < n)
-	{
-		j = i;
-		while (j < n)
-		{
-			dest[j] = '\0';
-			j++;
-		}
-	}
-	return (s);
+	if (n <= 0)
+		return (dest);
+	end = memchr(src, '\0', n - 1);
+	i = end ? end - src : n - 1;
+	memcpy(dest, src, i);
+	memset(dest + i, '\0', n - i);
+	return (dest);
 }
 
 /**
@@ -71,88 +61,30 @@ char *_strncat(char *dest, char *src, int n)
  */
 char *_strcpy(char *dest, char *src)
 {
-	int i = 0;
-
 	if (dest == src || src == 0)
 		return (dest);
-	while (src[i])
-	{
-		dest[i] = src[i];
-		i++;
-	}
-	dest[i] = 0;
+	memcpy(dest, src, str_ops.len(src) + 1);
 	return (dest);
 }
 
 /**
- * _strdup - duplicates a string
+ * _strdup_at - duplicates a string, called as _strdup(), which passes the
+ *		line it is called from for the allocation statistics to count
+ *		the copy against
  * @string: the string to duplicate
+ * @site: the caller's line
  * Return: pointer to the duplicated string
  */
-char *_strdup(const char *string)
+char *_strdup_at(const char *string, const char *site)
 {
-	int length = 0;
+	size_t length;
 	char *value;
 
 	if (string == NULL)
 		return (NULL);
-	while (*string++)
-		length++;
-	value = malloc(sizeof(char) * (length + 1));
+	length = str_ops.len(string) + 1;
+	value = mem_malloc(length, site);
 	if (!value)
 		return (NULL);
-	for (length++; length--;)
-		value[length] = *--string;
-	return (value);
+	return (memcpy(value, string, length));
 }
-
-/**
- *strtow - splits a string into words. Repeat delimiters are ignored
- * @string: the input string
- * @d: the delimeter string
- * Return: a pointer to an array of strings, or NULL on failure
- */
-
-char **strtow(char *string, char *d)
-{
-	int i, j, k, m, numwords = 0;
-	char **s;
-
-	if (string == NULL || string[0] == 0)
-		return (NULL);
-	if (!d)
-		d = " ";
-	for (i = 0; string[i] != '\0'; i++)
-		if (!isdelimeter(string[i], d)
-		    && (isdelimeter(string[i + 1], d)
-			|| !string[i + 1]))
-			numwords++;
-
-	if (numwords == 0)
-		return (NULL);
-	s = malloc((1 + numwords) * sizeof(char *));
-	if (!s)
-		return (NULL);
-	for (i = 0, j = 0; j < numwords; j++)
-	{
-		while (isdelimeter(string[i], d))
-			i++;
-		k = 0;
-		while (!isdelimeter(string[i + k], d) && string[i + k])
-			k++;
-		s[j] = malloc((k + 1) * sizeof(char));
-		if (!s[j])
-		{
-			for (k = 0; k < j; k++)
-				free(s[k]);
-			free(s);
-			return (NULL);
-		}
-		for (m = 0; m < k; m++)
-			s[j][m] = string[i++];
-		s[j][m] = 0;
-	}
-	s[j] = NULL;
-	return (s);
-}
-
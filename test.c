@@ -0,0 +1,149 @@
+#include "shell.h"
+
+int test_builtin(shell_t *);
+int test_list(test_t *, char *);
+int test_not(test_t *);
+int test_primary(test_t *);
+int test_error(test_t *, char *, char *);
+
+/**
+ * test_builtin - implements the test and [ commands: evaluates the
+ *		file, string and integer expression given as arguments.
+ * The expression is parsed by precedence, "-o" binding loosest, then
+ *		"-a", then "!", and a word followed by a binary operator is
+ *		always a comparison, as POSIX asks for three operands.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * Return: 0 if the expression is true, 1 if it is false, 2 on error.
+ */
+int test_builtin(shell_t *data)
+{
+	test_t t;
+	int value;
+
+	t.data = data;
+	t.argv = data->argv + 1;
+	t.i = t.error = 0;
+	for (t.argc = 0; t.argv[t.argc]; t.argc++)
+		;
+	if (!_strcmp(data->argv[0], "["))
+	{
+		if (!t.argc || _strcmp(t.argv[t.argc - 1], "]"))
+			return (test_error(&t, "missing ]", NULL), 2);
+		t.argc--;
+	}
+	if (!t.argc)
+		return (1);
+	value = test_list(&t, "-o");
+	if (!t.error && t.i < t.argc)
+		test_error(&t, t.argv[t.i], "unexpected operator");
+	return (t.error ? 2 : !value);
+}
+
+/**
+ * test_list - parses the operands joined by "-o", or by "-a".
+ * @t: the parser.
+ * @op: "-o" for a list of "-a" lists, "-a" for a list of negations.
+ * Return: the value of the list.
+ */
+int test_list(test_t *t, char *op)
+{
+	int value, next, and = op[1] == 'a';
+
+	value = and ? test_not(t) : test_list(t, "-a");
+	while (!t->error && t->i < t->argc && !_strcmp(t->argv[t->i], op))
+	{
+		t->i++;
+		next = and ? test_not(t) : test_list(t, "-a");
+		value = and ? value && next : value || next;
+	}
+	return (value);
+}
+
+/**
+ * test_not - parses an operand, negated by any number of "!".
+ * A "!" followed by a binary operator is the left side of a comparison.
+ * @t: the parser.
+ * Return: the value of the operand.
+ */
+int test_not(test_t *t)
+{
+	char **w = t->argv + t->i;
+	int left = t->argc - t->i;
+
+	if (left >= 2 && !_strcmp(w[0], "!") &&
+			!(left >= 3 && test_op(w[1]) == TEST_BINARY))
+	{
+		t->i++;
+		return (!test_not(t));
+	}
+	return (test_primary(t));
+}
+
+/**
+ * test_primary - parses a comparison, a parenthesized expression,
+ *		a unary operator and its operand, or a single string,
+ *		which is true when it is not empty.
+ * @t: the parser.
+ * Return: the value of the primary.
+ */
+int test_primary(test_t *t)
+{
+	char **w = t->argv + t->i;
+	int left = t->argc - t->i, value;
+
+	if (left < 1)
+		return (test_error(t, "argument expected", NULL));
+	if (left >= 3 && test_op(w[1]) == TEST_BINARY)
+	{
+		t->i += 3;
+		return (test_binary(t, w[0], w[1], w[2]));
+	}
+	if (left >= 2 && !_strcmp(w[0], "("))
+	{
+		t->i++;
+		value = test_list(t, "-o");
+		if (t->error)
+			return (0);
+		if (t->i >= t->argc || _strcmp(t->argv[t->i], ")"))
+			return (test_error(t, "closing paren expected", NULL));
+		t->i++;
+		return (value);
+	}
+	if (left >= 2 && test_op(w[0]) == TEST_UNARY)
+	{
+		t->i += 2;
+		return (test_unary(t, w[0], w[1]));
+	}
+	t->i++;
+	return (w[0][0] != '\0');
+}
+
+/**
+ * test_error - prints an error of the test builtin, the first one only.
+ * @t: the parser.
+ * @msg: the message, or the word in error.
+ * @detail: printed after the message, NULL if there is none.
+ * Return: 0.
+ */
+int test_error(test_t *t, char *msg, char *detail)
+{
+	if (t->error)
+		return (0);
+	t->error = 1;
+	_eputs(t->data->fname);
+	_eputs(": ");
+	decimal(t->data->count, STDERR_FILENO);
+	_eputs(": ");
+	_eputs(t->data->argv[0]);
+	_eputs(": ");
+	_eputs(msg);
+	if (detail)
+	{
+		_eputs(": ");
+		_eputs(detail);
+	}
+	_eputs("\n");
+	_puts2(BUF_FLUSH);
+	return (0);
+}
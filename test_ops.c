@@ -0,0 +1,152 @@
+#include "shell.h"
+
+int test_op(char *);
+int test_unary(test_t *, char *, char *);
+int test_binary(test_t *, char *, char *, char *);
+int test_files(test_t *, char *, char *, char *);
+long test_number(test_t *, char *);
+
+/**
+ * test_op - tells the operators of the test builtin apart from operands.
+ * @word: the word.
+ * Return: TEST_UNARY, TEST_BINARY, or 0 for an operand.
+ */
+int test_op(char *word)
+{
+	static char *binary[] = {"=", "!=", "-eq", "-ne", "-lt", "-le",
+		"-gt", "-ge", "-nt", "-ot", "-ef", NULL};
+	int i;
+
+	if (word[0] == '-' && word[1] && !word[2] &&
+			_strchr("bcdefghknprstuwxzGLOS", word[1]))
+		return (TEST_UNARY);
+	for (i = 0; binary[i]; i++)
+		if (!_strcmp(word, binary[i]))
+			return (TEST_BINARY);
+	return (0);
+}
+
+/**
+ * test_unary - evaluates a string, terminal or file test.
+ * File types and mode bits come from the stat cache; -r, -w and -x
+ *		ask the kernel, which knows about ACLs and read-only mounts.
+ * @t: the parser.
+ * @op: the operator.
+ * @arg: its operand.
+ * Return: the value of the test.
+ */
+int test_unary(test_t *t, char *op, char *arg)
+{
+	static const struct { char op; mode_t mask, want; } modes[] = {
+		{'e', 0, 0}, {'f', S_IFMT, S_IFREG}, {'d', S_IFMT, S_IFDIR},
+		{'b', S_IFMT, S_IFBLK}, {'c', S_IFMT, S_IFCHR},
+		{'p', S_IFMT, S_IFIFO}, {'S', S_IFMT, S_IFSOCK},
+		{'L', S_IFMT, S_IFLNK}, {'h', S_IFMT, S_IFLNK},
+		{'u', S_ISUID, S_ISUID}, {'g', S_ISGID, S_ISGID},
+		{'k', S_ISVTX, S_ISVTX}};
+	struct stat *st;
+	int i, c = op[1];
+
+	if (c == 'z' || c == 'n')
+		return ((arg[0] == '\0') == (c == 'z'));
+	if (c == 't')
+		return (isatty(test_number(t, arg)) && !t->error);
+	if (c == 'r' || c == 'w' || c == 'x')
+		return (!faccessat(AT_FDCWD, arg, c == 'r' ? R_OK :
+					c == 'w' ? W_OK : X_OK, AT_EACCESS));
+	st = cached_stat(t->data, arg, c == 'L' || c == 'h');
+	if (!st)
+		return (0);
+	if (c == 's')
+		return (st->st_size > 0);
+	if (c == 'O' || c == 'G')
+		return (c == 'O' ? st->st_uid == geteuid() :
+				st->st_gid == getegid());
+	for (i = 0; modes[i].op != c; i++)
+		;
+	return ((st->st_mode & modes[i].mask) == modes[i].want);
+}
+
+/**
+ * test_binary - evaluates a string, integer or file comparison.
+ * @t: the parser.
+ * @a: the left operand.
+ * @op: the operator.
+ * @b: the right operand.
+ * Return: the value of the comparison.
+ */
+int test_binary(test_t *t, char *a, char *op, char *b)
+{
+	long x, y;
+
+	if (op[0] != '-')
+		return (!_strcmp(a, b) == (op[0] == '='));
+	if (!_strcmp(op, "-nt") || !_strcmp(op, "-ot") ||
+			!_strcmp(op, "-ef"))
+		return (test_files(t, a, op, b));
+	x = test_number(t, a);
+	y = test_number(t, b);
+	if (t->error)
+		return (0);
+	if (op[1] == 'e')
+		return (x == y);
+	if (op[1] == 'n')
+		return (x != y);
+	if (op[1] == 'l')
+		return (op[2] == 't' ? x < y : x <= y);
+	return (op[2] == 't' ? x > y : x >= y);
+}
+
+/**
+ * test_files - compares two files by modification time, or tells
+ *		whether they are the same file.
+ * A file that exists is newer than one that does not.
+ * @t: the parser.
+ * @a: the left file.
+ * @op: "-nt", "-ot" or "-ef".
+ * @b: the right file.
+ * Return: the value of the comparison.
+ */
+int test_files(test_t *t, char *a, char *op, char *b)
+{
+	struct stat sa, *sb;
+	int have_a;
+	long diff;
+
+	sb = cached_stat(t->data, a, 0);
+	have_a = sb != NULL;
+	if (have_a)
+		sa = *sb; /* the next lookup may reuse the slot */
+	sb = cached_stat(t->data, b, 0);
+	if (op[1] == 'e')
+		return (have_a && sb && sa.st_dev == sb->st_dev &&
+				sa.st_ino == sb->st_ino);
+	if (!have_a || !sb)
+		return (op[1] == 'n' ? have_a && !sb : !have_a && sb);
+	diff = sa.st_mtim.tv_sec - sb->st_mtim.tv_sec;
+	if (!diff)
+		diff = sa.st_mtim.tv_nsec - sb->st_mtim.tv_nsec;
+	return (op[1] == 'n' ? diff > 0 : diff < 0);
+}
+
+/**
+ * test_number - converts an operand of an integer comparison.
+ * @t: the parser, whose error is set if the operand is not an integer.
+ * @s: the operand.
+ * Return: the integer, 0 on error.
+ */
+long test_number(test_t *t, char *s)
+{
+	char *end;
+	long n;
+
+	while (*s == ' ' || *s == '\t')
+		s++;
+	errno = 0;
+	n = strtol(s, &end, 10);
+	while (end != s && (*end == ' ' || *end == '\t'))
+		end++;
+	if (end == s || *end || errno)
+		return (test_error(t, "Illegal number", s));
+	return (n);
+}
@@ -0,0 +1,94 @@
+#include "shell.h"
+
+int tokenize(char *, const unsigned char *, strvec_t *);
+int strvec_push(strvec_t *, char *);
+void strvec_clear(strvec_t *);
+void strvec_free(strvec_t *);
+
+/*
+ * blank_delims - the word delimiters ' ' and '\t' as a 256-bit table,
+ * one bit per character: byte c >> 3, bit c & 7.
+ */
+const unsigned char blank_delims[32] = {0, 0x02, 0, 0, 0x01};
+
+/**
+ * tokenize - splits a string into words in a single pass.
+ *		Repeat delimiters are ignored.
+ * Characters are classified with a 256-bit table, and each word is
+ *		terminated in place, so the words are slices of the string
+ *		and nothing is copied.
+ * @string: the input string, modified in place
+ * @delims: the delimiter table, one bit per character
+ * @out: the vector the words are appended to, followed by a NULL
+ * Return: the number of words, or -1 on failure
+ */
+int tokenize(char *string, const unsigned char *delims, strvec_t *out)
+{
+	int words = 0;
+	char *p = string;
+
+	while (p && *p)
+	{
+		while (*p && IS_DELIM(delims, *p))
+			p++;
+		if (!*p)
+			break;
+		if (strvec_push(out, p) == -1)
+			return (-1);
+		words++;
+		while (*p && !IS_DELIM(delims, *p))
+			p++;
+		if (*p)
+			*p++ = '\0';
+	}
+	if (strvec_push(out, NULL) == -1)
+		return (-1);
+	return (words);
+}
+
+/**
+ * strvec_push - appends a string pointer to a vector, doubling its size
+ *		when it is full.
+ * @vec: the vector
+ * @string: the string to append, may be NULL
+ * Return: 0 on success, -1 on failure
+ */
+int strvec_push(strvec_t *vec, char *string)
+{
+	char **v;
+	size_t cap;
+
+	if (vec->len == vec->cap)
+	{
+		cap = vec->cap ? vec->cap * 2 : 16;
+		v = realloc(vec->v, sizeof(char *) * cap);
+		if (!v)
+			return (-1);
+		vec->v = v;
+		vec->cap = cap;
+	}
+	vec->v[vec->len++] = string;
+	return (0);
+}
+
+/**
+ * strvec_clear - frees the strings of a vector and empties it,
+ *		keeping its slots for reuse.
+ * @vec: the vector
+ */
+void strvec_clear(strvec_t *vec)
+{
+	while (vec->len)
+		free(vec->v[--vec->len]);
+}
+
+/**
+ * strvec_free - frees the slots of a vector, but not its strings.
+ * @vec: the vector
+ */
+void strvec_free(strvec_t *vec)
+{
+	free(vec->v);
+	vec->v = NULL;
+	vec->len = vec->cap = 0;
+}
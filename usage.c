@@ -0,0 +1,161 @@
+#include "shell.h"
+
+int run_measured(shell_t *, program_t *, insn_t *, int);
+void usage_done(shell_t *, usage_t *, usage_t *, int);
+void usage_add(struct rusage *, struct rusage *);
+void time_report(usage_t *);
+int usage_var(shell_t *, char *, size_t, strbuf_t *);
+
+/**
+ * run_measured - runs a pipeline or a single command and records what
+ *		it cost: its wall clock time, and what the processes the
+ *		shell waited for used, as reported by wait4().
+ * A pipeline prefixed by time also counts the shell's own time, spent
+ *		in builtins, and has the numbers printed.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * @prog: the compiled program.
+ * @in: the first instruction of the pipeline.
+ * @n: the number of instructions of the pipeline.
+ * Return: the result of the command.
+ */
+int run_measured(shell_t *data, program_t *prog, insn_t *in, int n)
+{
+	usage_t u, start;
+	int result;
+
+	memset(&u, 0, sizeof(u));
+	data->acct = &u;
+	clock_gettime(CLOCK_MONOTONIC, &start.real);
+	if (in->timed)
+		getrusage(RUSAGE_SELF, &start.ru);
+	if (n > 1 || in[n - 1].async)
+		result = run_pipeline(data, prog, in, n);
+	else
+		result = run_insn(data, prog, in);
+	data->acct = NULL;
+	usage_done(data, &u, &start, in->timed);
+	return (result);
+}
+
+/**
+ * usage_done - completes the usage of a command that just ran and makes
+ *		it the last command's.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * @u: the usage of the command's jobs.
+ * @start: the clock, and the shell's usage if timed, when it started.
+ * @timed: non-zero to add the shell's own usage and print the result.
+ */
+void usage_done(shell_t *data, usage_t *u, usage_t *start, int timed)
+{
+	struct timespec now;
+	struct rusage self;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	u->real.tv_sec = now.tv_sec - start->real.tv_sec;
+	u->real.tv_nsec = now.tv_nsec - start->real.tv_nsec;
+	if (u->real.tv_nsec < 0)
+	{
+		u->real.tv_sec--;
+		u->real.tv_nsec += 1000000000L;
+	}
+	if (timed)
+	{
+		getrusage(RUSAGE_SELF, &self);
+		timersub(&self.ru_utime, &start->ru.ru_utime, &self.ru_utime);
+		timersub(&self.ru_stime, &start->ru.ru_stime, &self.ru_stime);
+		self.ru_nvcsw -= start->ru.ru_nvcsw;
+		self.ru_nivcsw -= start->ru.ru_nivcsw;
+		self.ru_maxrss = 0; /* the shell's peak is not the command's */
+		usage_add(&u->ru, &self);
+		time_report(u);
+	}
+	data->usage = *u;
+}
+
+/**
+ * usage_add - adds the times and context switches of a usage to another,
+ *		which keeps the larger of the two maximum resident sets.
+ * @to: the usage added to.
+ * @ru: the usage to add.
+ */
+void usage_add(struct rusage *to, struct rusage *ru)
+{
+	timeradd(&to->ru_utime, &ru->ru_utime, &to->ru_utime);
+	timeradd(&to->ru_stime, &ru->ru_stime, &to->ru_stime);
+	if (ru->ru_maxrss > to->ru_maxrss)
+		to->ru_maxrss = ru->ru_maxrss;
+	to->ru_nvcsw += ru->ru_nvcsw;
+	to->ru_nivcsw += ru->ru_nivcsw;
+}
+
+/**
+ * time_report - prints the usage of a timed command on standard error.
+ * @u: the usage.
+ */
+void time_report(usage_t *u)
+{
+	static char *names[] = {"real", "user", "sys"};
+	struct timeval tv[3];
+	char buf[128];
+	int i;
+
+	tv[0].tv_sec = u->real.tv_sec;
+	tv[0].tv_usec = u->real.tv_nsec / 1000;
+	tv[1] = u->ru.ru_utime;
+	tv[2] = u->ru.ru_stime;
+	_eputs("\n");
+	for (i = 0; i < 3; i++)
+	{
+		snprintf(buf, sizeof(buf), "%s\t%ldm%ld.%03lds\n",
+				names[i], (long)tv[i].tv_sec / 60,
+				(long)tv[i].tv_sec % 60,
+				(long)tv[i].tv_usec / 1000);
+		_eputs(buf);
+	}
+	snprintf(buf, sizeof(buf), "maxrss\t%ldk\nnvcsw\t%ld\n"
+			"nivcsw\t%ld\n", u->ru.ru_maxrss, u->ru.ru_nvcsw,
+			u->ru.ru_nivcsw);
+	_eputs(buf);
+	_puts2(BUF_FLUSH);
+}
+
+/**
+ * usage_var - expands the variables describing the last command's cost:
+ *		HSH_REAL, HSH_USER and HSH_SYS in seconds, HSH_MAXRSS in
+ *		kilobytes, HSH_NVCSW and HSH_NIVCSW in context switches.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * @name: the variable's name, not terminated after it.
+ * @nlen: the length of the name.
+ * @sb: the buffer the value is appended to.
+ * Return: 1 if the value was appended, 0 if name is not one of them,
+ *		-1 if memory ran out.
+ */
+int usage_var(shell_t *data, char *name, size_t nlen, strbuf_t *sb)
+{
+	static char *names[] = {"HSH_REAL", "HSH_USER", "HSH_SYS",
+		"HSH_MAXRSS", "HSH_NVCSW", "HSH_NIVCSW", NULL};
+	struct rusage *ru = &data->usage.ru;
+	struct timeval tv;
+	char buf[32];
+	int i, n;
+
+	for (i = 0; names[i] && ((size_t)_strlen(names[i]) != nlen ||
+				memcmp(name, names[i], nlen)); i++)
+		;
+	if (!names[i])
+		return (0);
+	tv.tv_sec = data->usage.real.tv_sec;
+	tv.tv_usec = data->usage.real.tv_nsec / 1000;
+	if (i == 1 || i == 2)
+		tv = i == 1 ? ru->ru_utime : ru->ru_stime;
+	if (i < 3)
+		n = snprintf(buf, sizeof(buf), "%ld.%06ld", (long)tv.tv_sec,
+				(long)tv.tv_usec);
+	else
+		n = snprintf(buf, sizeof(buf), "%ld", i == 3 ? ru->ru_maxrss :
+				i == 4 ? ru->ru_nvcsw : ru->ru_nivcsw);
+	return (strbuf_add(sb, buf, n) == -1 ? -1 : 1);
+}
@@ -0,0 +1,140 @@
+#include "shell.h"
+
+size_t is_assignment(char *);
+int assign_builtin(shell_t *);
+int set_var(shell_t *, char *);
+int export_builtin(shell_t *);
+int unset_builtin(shell_t *);
+
+/**
+ * is_assignment - tells whether a word is a NAME=value assignment.
+ * @word: the word.
+ * Return: the length of the name, 0 if the word is not an assignment.
+ */
+size_t is_assignment(char *word)
+{
+	size_t n = 0;
+
+	if (word[0] >= '0' && word[0] <= '9')
+		return (0);
+	while (IS_NAME_CHAR(word[n]))
+		n++;
+	return (n && word[n] == '=' ? n : 0);
+}
+
+/**
+ * assign_builtin - runs a command made of NAME=value words: sets each
+ *		variable, in the environment if it is exported there, or else
+ *		as a shell variable, which commands do not see.
+ * Assignments in front of a command are not supported; such a command
+ *		is not found, as before there were assignments.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * Return: 0 on success, 127 if a word is not an assignment, 1 if memory
+ *		ran out.
+ */
+int assign_builtin(shell_t *data)
+{
+	int i;
+
+	for (i = 0; data->argv[i]; i++)
+		if (!is_assignment(data->argv[i]))
+		{
+			_perror(data, "not found\n");
+			return (127);
+		}
+	for (i = 0; data->argv[i]; i++)
+		if (set_var(data, data->argv[i]) == -1)
+		{
+			_perror(data, "out of memory\n");
+			return (1);
+		}
+	return (0);
+}
+
+/**
+ * set_var - sets a variable from a NAME=value word, keeping it exported
+ *		if it was.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * @word: the assignment.
+ * Return: 0 on success, -1 if memory ran out.
+ */
+int set_var(shell_t *data, char *word)
+{
+	size_t nlen = is_assignment(word);
+	char *str = _strdup(word);
+
+	if (!str)
+		return (-1);
+	if (env_value(&data->env, word, nlen))
+		return (env_put(&data->env, str));
+	return (env_put(&data->vars, str));
+}
+
+/**
+ * export_builtin - implements the export command: exports each NAME,
+ *		with its shell value if it has one, and sets and exports each
+ *		NAME=value. Without arguments, lists the exported variables.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * Return: 0 on success, 2 for a bad name, 1 if memory ran out.
+ */
+int export_builtin(shell_t *data)
+{
+	size_t i, nlen;
+	char *word, *value, *str;
+	int status = 0;
+
+	for (i = 0; data->argc == 1 && i < data->env.len; i++)
+		if (data->env.envp[i])
+		{
+			_puts("export ");
+			_puts(data->env.envp[i]);
+			_putchar('\n');
+		}
+	for (i = 1; (word = data->argv[i]); i++)
+	{
+		for (nlen = 0; IS_NAME_CHAR(word[nlen]); nlen++)
+			;
+		if (!nlen || (word[nlen] && word[nlen] != '=') ||
+				(word[0] >= '0' && word[0] <= '9'))
+		{
+			_perror(data, word);
+			_eputs(": bad variable name\n");
+			status = 2;
+			continue;
+		}
+		value = word[nlen] ? word + nlen + 1 :
+			env_value(&data->vars, word, nlen);
+		if (!value)
+			continue; /* not set, or already exported */
+		str = _strdup(value - nlen - 1);
+		env_remove(&data->vars, word, nlen);
+		if (!str || env_put(&data->env, str) == -1)
+			status = 1;
+	}
+	return (status);
+}
+
+/**
+ * unset_builtin - implements the unset command: unsets each named
+ *		variable, exported or not.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * Return: 0.
+ */
+int unset_builtin(shell_t *data)
+{
+	int i = 1;
+
+	if (data->argv[i] && !_strcmp(data->argv[i], "-v"))
+		i++;
+	for (; data->argv[i]; i++)
+	{
+		env_remove(&data->vars, data->argv[i],
+				_strlen(data->argv[i]));
+		_unsetenv(data, data->argv[i]);
+	}
+	return (0);
+}
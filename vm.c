@@ -0,0 +1,186 @@
+#include "shell.h"
+
+int execute_script(shell_t *, char **);
+int run_program(shell_t *, program_t *, char **);
+int run_insn(shell_t *, program_t *, insn_t *);
+int load_insn(shell_t *, program_t *, insn_t *);
+int syntax_error(shell_t *, char *);
+
+/**
+ * execute_script - compiles the script given on the command line
+ *		and runs it from the instruction loop.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * @argv: array of strings representing the command line arguments from main()
+ * Return: the result of the last command, -2 if the script ran exit,
+ *		or -1 if it could not be compiled.
+ */
+int execute_script(shell_t *data, char **argv)
+{
+	program_t prog;
+	int result = -1;
+
+	memset(&prog, 0, sizeof(prog));
+	if (!compile_script(data, &prog))
+		result = run_program(data, &prog, argv);
+	free_program(&prog);
+	return (result);
+}
+
+/**
+ * run_program - the interpreter loop: runs every instruction whose
+ *		condition holds for the status left by the previous command.
+ * A command skipped by '&&' or '||' leaves the status untouched,
+ *		so the next operator tests the same result. The commands of
+ *		a pipeline run or are skipped together. The stat cache of the
+ *		test builtin does not outlive the program. A script forgets
+ *		its finished background jobs before each command.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * @prog: the compiled program.
+ * @argv: array of strings representing the command line arguments from main()
+ * Return: the result of the last command, or -2 when exit was run.
+ */
+int run_program(shell_t *data, program_t *prog, char **argv)
+{
+	insn_t *in, *end = prog->code + prog->len;
+	int n, result = 0;
+
+	for (in = prog->code; in < end && result != -2; in += n)
+	{
+		if (interactive(data))
+			reap_jobs(data);
+		else
+			notify_jobs(data);
+		for (n = 1; in + n < end && in[n].cond == RUN_PIPED; n++)
+			;
+		if ((in->cond == RUN_IF_OK && data->status) ||
+				(in->cond == RUN_IF_FAIL && !data->status))
+			continue;
+		clear_data(data);
+		data->fname = argv[0];
+		if (in->line)
+			data->count = in->line;
+		if (!in->argc && !in->nredir)
+		{
+			result = syntax_error(data, prog->words.v[in->argv]);
+			flush_output(data);
+			break;
+		}
+		result = run_measured(data, prog, in, n);
+		flush_output(data);
+	}
+	stat_cache_flush(data);
+	dir_cache_flush(data);
+	return (result);
+}
+
+/**
+ * run_insn - runs one compiled command as a builtin
+ *		or an external command.
+ * A builtin's redirections are installed in the shell for as long as
+ *		it runs; an external command gets them through data->redir.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * @prog: the compiled program.
+ * @in: the instruction to run.
+ * Return: the value returned by the builtin, or -1 for other commands.
+ */
+int run_insn(shell_t *data, program_t *prog, insn_t *in)
+{
+	builtin_t *builtin;
+	launch_t redir;
+	int saved[3], result = 0;
+
+	if (load_insn(data, prog, in) == -1)
+		return (result);
+	launch_init(&redir);
+	builtin = data->argc ? lookup_builtin(data->argv[0]) : NULL;
+	if (open_redirs(data, prog, in, &redir) == -1)
+		result = 0;
+	else if (builtin || !data->argc)
+	{
+		if (in->nredir)
+			swap_fds(&redir, saved);
+		if (builtin)
+			result = run_builtin(data, builtin);
+		else
+			data->status = 0; /* only redirections */
+		if (in->nredir)
+			restore_fds(saved);
+	}
+	else
+	{
+		data->redir = in->nredir ? &redir : NULL;
+		parse_command(data);
+		data->redir = NULL;
+		result = -1;
+	}
+	close_redirs(&redir);
+	free_data(data, 0);
+	data->arg = NULL;
+	return (result);
+}
+
+/**
+ * load_insn - points data->argv at the words of a compiled command,
+ *		then expands aliases, variables when the command or an alias
+ *		has any, and patterns.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * @prog: the compiled program.
+ * @in: the instruction to load.
+ * Return: 0 on success, -1 if memory ran out.
+ */
+int load_insn(shell_t *data, program_t *prog, insn_t *in)
+{
+	char **words = prog->words.v + in->argv;
+	int i, aliased = 0;
+
+	data->args.len = 0;
+	for (i = 0; i <= in->argc; i++) /* the words and their NULL */
+		if (strvec_push(&data->args, words[i]) == -1)
+			return (-1);
+	data->argv = data->args.v;
+	data->argc = in->argc;
+	if (in->argc)
+		aliased = replace_alias(data);
+	if (aliased == -1)
+		return (-1);
+	if ((in->vars || aliased) && replace_vars(data) == -1)
+		return (-1);
+	if (expand_globs(data) == -1)
+		return (-1);
+	/* the command's first word stands in for the raw input line */
+	data->arg = data->argv[0];
+	return (0);
+}
+
+/**
+ * syntax_error - reports a syntax error found while compiling a line.
+ *		A non-interactive shell stops, like sh does.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * @token: the unexpected token, or NULL for an unexpected end of line.
+ * Return: -2 to make a non-interactive shell exit, 0 otherwise.
+ */
+int syntax_error(shell_t *data, char *token)
+{
+	_eputs(data->fname);
+	_eputs(": ");
+	decimal(data->count, STDERR_FILENO);
+	_eputs(": Syntax error: ");
+	if (token)
+	{
+		_eputs("\"");
+		_eputs(token);
+		_eputs("\" unexpected\n");
+	}
+	else
+		_eputs("end of file unexpected\n");
+	data->status = 2;
+	if (interactive(data))
+		return (0);
+	data->estatus = 2;
+	return (-2);
+}
@@ -0,0 +1,182 @@
+#include "shell.h"
+
+int walk_tree(shell_t *, strbuf_t *, char *, strvec_t *);
+int walk_threads(shell_t *);
+int walk_merge(walk_t *, arena_t *, strvec_t *);
+void *walk_worker(void *);
+char *walk_next(walkq_t *);
+
+/**
+ * walk_tree - walks the tree under a directory with as many threads as
+ *		HSH_GLOB_THREADS asks for, and collects the paths of the names
+ *		that match a component, in order.
+ * Names starting with a '.' are not walked into, and only matched by a
+ *		component that starts with one; symbolic links are not
+ *		followed, so that the walk ends.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * @path: the directory, with its trailing '/', empty for the current one.
+ * @pat: the component, as in walk_t.
+ * @found: the sorted paths, allocated on the shell's arena, on success.
+ * Return: 0 on success, -1 if memory ran out.
+ */
+int walk_tree(shell_t *data, strbuf_t *path, char *pat, strvec_t *found)
+{
+	pthread_t tid[WALK_MAX_THREADS];
+	sigset_t all, old;
+	walk_t w;
+	int i, n = walk_threads(data);
+	char *root;
+
+	memset(&w, 0, sizeof(w));
+	w.q = calloc(n, sizeof(walkq_t));
+	if (!w.q)
+		return (-1);
+	w.rootfd = open(path->len ? path->s : ".",
+			O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+	w.base = path->len;
+	w.pat = pat;
+	w.n = n;
+	pthread_mutex_init(&w.lock, NULL);
+	pthread_cond_init(&w.cond, NULL);
+	for (i = 0; i < n; i++)
+	{
+		pthread_mutex_init(&w.q[i].lock, NULL);
+		w.q[i].walk = &w;
+	}
+	root = arena_strndup(&w.q[0].arena, path->len ? path->s : "",
+			path->len);
+	if (!root)
+		w.error = 1;
+	else if (w.rootfd != -1)
+		walk_push(&w.q[0], &root, 1);
+	sigfillset(&all);
+	pthread_sigmask(SIG_SETMASK, &all, &old); /* the shell takes them */
+	for (n = 1; n < w.n && !pthread_create(&tid[n], NULL, walk_worker,
+				&w.q[n]); n++)
+		;
+	pthread_sigmask(SIG_SETMASK, &old, NULL);
+	walk_worker(&w.q[0]);
+	while (--n > 0)
+		pthread_join(tid[n], NULL);
+	if (w.rootfd != -1)
+		close(w.rootfd);
+	return (walk_merge(&w, &data->arena, found));
+}
+
+/**
+ * walk_threads - reads the number of threads of a walk from the
+ *		HSH_GLOB_THREADS variable, by default the number of processors.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * Return: the number of threads, between 1 and WALK_MAX_THREADS.
+ */
+int walk_threads(shell_t *data)
+{
+	char *s = _getenv(data, "HSH_GLOB_THREADS=");
+	long n = s ? strtol(s, NULL, 10) : sysconf(_SC_NPROCESSORS_ONLN);
+
+	if (n < 1)
+		return (1);
+	return (n > WALK_MAX_THREADS ? WALK_MAX_THREADS : n);
+}
+
+/**
+ * walk_merge - gathers what the workers of a walk found, sorted so that
+ *		the result does not depend on which worker read what, and
+ *		frees the workers, their memory going to the shell's arena.
+ * @w: the walk, over.
+ * @arena: the arena.
+ * @found: the paths, on success.
+ * Return: 0 on success, -1 if memory ran out, during the walk or now.
+ */
+int walk_merge(walk_t *w, arena_t *arena, strvec_t *found)
+{
+	walkq_t *q;
+	size_t j;
+
+	for (q = w->q; q < w->q + w->n; q++)
+	{
+		for (j = 0; !w->error && j < q->found.len; j++)
+			if (strvec_push(found, q->found.v[j]) == -1)
+				w->error = 1;
+		strvec_free(&q->found);
+		arena_adopt(arena, &q->arena);
+		free(q->v);
+		pthread_mutex_destroy(&q->lock);
+	}
+	free(w->q);
+	pthread_mutex_destroy(&w->lock);
+	pthread_cond_destroy(&w->cond);
+	if (w->error)
+		return (strvec_free(found), -1);
+	if (found->len)
+		qsort(found->v, found->len, sizeof(char *), glob_compare);
+	return (0);
+}
+
+/**
+ * walk_worker - reads directories until none are left to read.
+ * @arg: the worker.
+ * Return: NULL.
+ */
+void *walk_worker(void *arg)
+{
+	walkq_t *q = arg;
+	walk_t *w = q->walk;
+	char *dir;
+
+	while ((dir = walk_next(q)))
+	{
+		if (!w->error)
+			walk_dir(q, dir);
+		if (__sync_sub_and_fetch(&w->pending, 1) == 0)
+		{
+			pthread_mutex_lock(&w->lock);
+			pthread_cond_broadcast(&w->cond);
+			pthread_mutex_unlock(&w->lock);
+		}
+	}
+	return (NULL);
+}
+
+/**
+ * walk_next - takes the next directory for a worker to read: its newest,
+ *		or else the oldest of another worker's, or else waits for one
+ *		to be queued.
+ * @q: the worker.
+ * Return: the directory, or NULL when the walk is over.
+ */
+char *walk_next(walkq_t *q)
+{
+	walk_t *w = q->walk;
+	walkq_t *from;
+	char *dir = NULL;
+	int i, over;
+
+	while (1)
+	{
+		for (i = 0; !dir && i < w->n; i++)
+		{
+			from = &w->q[(q - w->q + i) % w->n];
+			pthread_mutex_lock(&from->lock);
+			if (from->head < from->len)
+				dir = i ? from->v[from->head++] :
+					from->v[--from->len];
+			if (from->head == from->len)
+				from->head = from->len = 0;
+			pthread_mutex_unlock(&from->lock);
+		}
+		if (dir)
+			return (__sync_sub_and_fetch(&w->queued, 1), dir);
+		pthread_mutex_lock(&w->lock);
+		__sync_add_and_fetch(&w->idle, 1);
+		while (!WALK_LOAD(w->queued) && WALK_LOAD(w->pending))
+			pthread_cond_wait(&w->cond, &w->lock);
+		__sync_sub_and_fetch(&w->idle, 1);
+		over = !WALK_LOAD(w->pending);
+		pthread_mutex_unlock(&w->lock);
+		if (over)
+			return (NULL);
+	}
+}
@@ -0,0 +1,136 @@
+#include "shell.h"
+
+void walk_dir(walkq_t *, char *);
+int walk_entry(walkq_t *, int, char *, char *, int, strvec_t *);
+int walk_push(walkq_t *, char **, size_t);
+
+/**
+ * walk_dir - reads a directory of a walk with getdents64(), relative to
+ *		the directory the walk started at, keeps the names that
+ *		match, and queues the directories under it for any worker.
+ * @q: the worker reading it.
+ * @dir: the directory's path, ending with '/' unless it is the start.
+ */
+void walk_dir(walkq_t *q, char *dir)
+{
+	walk_t *w = q->walk;
+	strvec_t subdirs = {NULL, 0, 0};
+	char buf[WALK_BUF_SIZE];
+	struct dirent64 *ent;
+	ssize_t n, pos;
+	int fd;
+
+	fd = openat(w->rootfd, dir[w->base] ? dir + w->base : ".",
+			O_RDONLY | O_DIRECTORY | O_NOFOLLOW | O_CLOEXEC);
+	if (fd == -1)
+		return; /* gone or unreadable: skipped, as by readdir() */
+	while (!w->error && (n = getdents64(fd, buf, sizeof(buf))) > 0)
+		for (pos = 0; pos < n; pos += ent->d_reclen)
+		{
+			ent = (struct dirent64 *)(buf + pos);
+			if (!_strcmp(ent->d_name, ".") ||
+					!_strcmp(ent->d_name, ".."))
+				continue;
+			if (walk_entry(q, fd, dir, ent->d_name, ent->d_type,
+						&subdirs) == -1)
+				w->error = 1;
+		}
+	close(fd);
+	if (subdirs.len && walk_push(q, subdirs.v, subdirs.len) == -1)
+		w->error = 1;
+	strvec_free(&subdirs);
+}
+
+/**
+ * walk_entry - keeps a name if it matches the walk's component, and
+ *		adds it to the directories to queue if it is one.
+ * @q: the worker reading the directory.
+ * @fd: the directory, for the names whose type it does not tell.
+ * @dir: its path.
+ * @name: the name.
+ * @type: its type, as getdents64() tells it.
+ * @subdirs: the directories to queue.
+ * Return: 0 on success, -1 if memory ran out.
+ */
+int walk_entry(walkq_t *q, int fd, char *dir, char *name, int type,
+		strvec_t *subdirs)
+{
+	walk_t *w = q->walk;
+	char *path, *copy;
+	int keep, sub, hidden = name[0] == '.';
+	size_t dlen = _strlen(dir), nlen = _strlen(name);
+	struct stat st;
+
+	if (type == DT_UNKNOWN && !fstatat(fd, name, &st, AT_SYMLINK_NOFOLLOW))
+		type = S_ISDIR(st.st_mode) ? DT_DIR : DT_REG;
+	sub = type == DT_DIR && !hidden;
+	if (w->pat && *w->pat)
+		keep = (!hidden || *w->pat == '.') && glob_match(w->pat, name);
+	else
+		keep = w->pat ? !hidden : sub;
+	if (!keep && !sub)
+		return (0);
+	path = arena_alloc(&q->arena, dlen + nlen + 2);
+	if (!path)
+		return (-1);
+	memcpy(path, dir, dlen);
+	memcpy(path + dlen, name, nlen);
+	path[dlen + nlen] = '/';
+	path[dlen + nlen + 1] = '\0';
+	copy = path;
+	if (keep && w->pat)
+		copy = arena_strndup(&q->arena, path, dlen + nlen);
+	if (keep && (!copy || strvec_push(&q->found, copy) == -1))
+		return (-1);
+	if (sub && strvec_push(subdirs, path) == -1)
+		return (-1);
+	return (0);
+}
+
+/**
+ * walk_push - queues directories on a worker's deque, after counting them
+ *		as pending so that the walk does not end before they are read,
+ *		and wakes the workers waiting for some.
+ * @q: the worker.
+ * @dirs: the directories.
+ * @n: the number of directories.
+ * Return: 0 on success, -1 if memory ran out.
+ */
+int walk_push(walkq_t *q, char **dirs, size_t n)
+{
+	walk_t *w = q->walk;
+	size_t cap;
+	char **v = NULL;
+	int ok;
+
+	pthread_mutex_lock(&q->lock);
+	if (q->head && q->len + n > q->cap)
+	{
+		memmove(q->v, q->v + q->head,
+				sizeof(char *) * (q->len - q->head));
+		q->len -= q->head;
+		q->head = 0;
+	}
+	for (cap = q->cap ? q->cap : 16; cap < q->len + n; cap *= 2)
+		;
+	ok = cap == q->cap || (v = realloc(q->v, sizeof(char *) * cap)) != NULL;
+	if (ok)
+	{
+		q->v = v ? v : q->v;
+		q->cap = cap;
+		__sync_add_and_fetch(&w->pending, n);
+		memcpy(q->v + q->len, dirs, sizeof(char *) * n);
+		q->len += n;
+	}
+	pthread_mutex_unlock(&q->lock);
+	if (!ok)
+		return (-1);
+	__sync_add_and_fetch(&w->queued, n);
+	if (WALK_LOAD(w->idle))
+	{
+		pthread_mutex_lock(&w->lock);
+		pthread_cond_broadcast(&w->cond);
+		pthread_mutex_unlock(&w->lock);
+	}
+	return (0);
+}
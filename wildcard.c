@@ -1,72 +1,179 @@
 #include "shell.h"
 
+int expand_globs(shell_t *);
+int glob_word(shell_t *, char *, strbuf_t *, strvec_t *);
+int glob_walk(shell_t *, strbuf_t *, char *, strvec_t *);
+int glob_entries(shell_t *, strbuf_t *, char *, strvec_t *);
+int glob_push(shell_t *, strbuf_t *, char *, strvec_t *);
+
 /**
- * expand_wildcards - expands wildcards in a string
- *		and returns an array of strings.
- * @arg: A pointer to a string, the argument that may contain wildcard chars.
- * Return: returns the original argument as a single element array.
+ * expand_globs - replaces each word of the command that is a pattern
+ *		with the paths it matches, all in the one argv.
+ * A command without a pattern is left as it is. The new words are built
+ *		in data->globs, which then swaps places with data->args.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * Return: 0 on success, -1 if memory ran out.
  */
-char **expand_wildcards(char *arg)
+int expand_globs(shell_t *data)
 {
-	glob_t glob_result;
-	int flags = 0;
-	char **result = NULL;
-	int i, n;
+	strvec_t *out = &data->globs, args;
+	int i;
 
-	if (glob(arg, flags, NULL, &glob_result) != 0)
-	{
-		result = malloc(sizeof(char *) * 2);
-		result[0] = arg;
-		result[1] = NULL;
-	}
-	else
-	{
-		n = glob_result.gl_pathc;
-		result = malloc(sizeof(char *) * (n + 1));
-		for (i = 0; i < n; i++)
-		{
-			result[i] = strdup(glob_result.gl_pathv[i]);
-		}
-		result[n] = NULL;
-		globfree(&glob_result);
-	}
+	for (i = 0; data->argv[i] && !glob_meta(data->argv[i], 1); i++)
+		;
+	if (!data->argv[i])
+		return (0);
+	out->len = 0;
+	for (i = 0; data->argv[i]; i++)
+		if (glob_word(data, data->argv[i], &data->globpath, out) == -1)
+			return (-1);
+	if (strvec_push(out, NULL) == -1)
+		return (-1);
+	args = data->args;
+	data->args = *out;
+	*out = args;
+	data->argv = data->args.v;
+	data->argc = data->args.len - 1;
+	return (0);
+}
+
+/**
+ * glob_word - appends the paths a word matches, sorted unless GLOBSORT
+ *		is "nosort", or the word itself if it matches nothing or is
+ *		not a pattern.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * @word: the word.
+ * @path: a buffer for the paths being built.
+ * @out: the words of the command being built.
+ * Return: 0 on success, -1 if memory ran out.
+ */
+int glob_word(shell_t *data, char *word, strbuf_t *path, strvec_t *out)
+{
+	size_t start = out->len;
+	char *sort;
+
+	if (!glob_meta(word, 1))
+		return (strvec_push(out, word));
+	path->len = 0;
+	if (glob_walk(data, path, word, out) == -1)
+		return (-1);
+	if (out->len == start)
+		return (strvec_push(out, word));
+	sort = _getenv(data, "GLOBSORT");
+	if (!sort || _strcmp(sort, "nosort"))
+		qsort(out->v + start, out->len - start, sizeof(char *),
+				glob_compare);
+	return (0);
+}
+
+/**
+ * glob_walk - matches the rest of a pattern, one component at a time,
+ *		under the directory built so far: a component without special
+ *		characters is taken as it is, ** is matched by glob_star(),
+ *		and any other one against the names in the directory.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * @path: the directory so far, with its trailing '/', empty for the
+ *		current directory; it is given back as it was.
+ * @pat: the rest of the pattern.
+ * @out: the words of the command being built.
+ * Return: 0 on success, -1 if memory ran out.
+ */
+int glob_walk(shell_t *data, strbuf_t *path, char *pat, strvec_t *out)
+{
+	size_t len = path->len;
+	char *slash = pat;
+	struct stat st;
+	int result = 0;
+
+	if (pat[0] == '*' && pat[1] == '*' && (!pat[2] || pat[2] == '/'))
+		return (glob_star(data, path, pat + 2, out));
+	if (glob_meta(pat, 0))
+		return (glob_entries(data, path, pat, out));
+	while (*slash && *slash != '/')
+		slash++;
+	if (strbuf_add(path, pat, slash - pat + (*slash == '/')) == -1 ||
+			strbuf_add(path, "", 1) == -1)
+		return (-1);
+	path->len--;
+	if (*slash && slash[1])
+		result = glob_walk(data, path, slash + 1, out);
+	else if (!lstat(path->s, &st))
+		result = glob_push(data, path, NULL, out);
+	path->len = len;
 	return (result);
 }
 
 /**
- * execute_wildcard - expands wildcard chars (* and ?) in command-line argument
- *		and executing the corresponding commands.
+ * glob_entries - matches a component of a pattern against the names in
+ *		a directory, then matches the rest of the pattern under each
+ *		one that is a directory, if there is a rest.
+ * A name starting with a '.' is only matched by a component that does.
  * @data: A pointer to the shell data structure,
  *		which contains information about the current state of the shell.
-* Return: If no wildcard expansion occurs for any argument,
- * the function simply calls the parse_command() function
- *				to execute the command as it is.
+ * @path: the directory, as in glob_walk().
+ * @pat: the component and the rest of the pattern.
+ * @out: the words of the command being built.
+ * Return: 0 on success, -1 if memory ran out.
  */
-void execute_wildcard(shell_t *data)
+int glob_entries(shell_t *data, strbuf_t *path, char *pat, strvec_t *out)
 {
-	int i, j = 0;
-	int wildcard_expanded = 0;
-	char **expanded = NULL;
+	dirlist_t *d = dir_list(data, path->len ? path->s : ".");
+	char *slash = pat, *name;
+	size_t i, len = path->len;
+	int type, result = 0;
+	struct stat st;
 
-	for (i = 0; data->argv[i]; i++)
+	while (*slash && *slash != '/')
+		slash++;
+	for (i = 0; d && i < d->names.len && result != -1; i++)
 	{
-		if (strchr(data->argv[i], '*') != NULL || strchr(data->argv[i], '?') != NULL)
+		name = d->names.v[i];
+		if ((name[0] == '.' && pat[0] != '.') || !glob_match(pat, name))
+			continue;
+		if (strbuf_add(path, name, _strlen(name) + 1) == -1)
+			return (-1);
+		path->len--;
+		type = (unsigned char)d->types.s[i];
+		if (!*slash)
+			result = glob_push(data, path, len ? NULL : name, out);
+		else if (type == DT_DIR || ((type == DT_LNK ||
+				type == DT_UNKNOWN) && !stat(path->s, &st) &&
+				S_ISDIR(st.st_mode)))
 		{
-			expanded = expand_wildcards(data->argv[i]);
-			while (expanded[j] != NULL)
-			{
-				data->argv[i] = expanded[j];
-				wildcard_expanded = 1;
-				parse_command(data);
-				j++;
-			}
-			free(expanded);
+			result = strbuf_add(path, "/", 2);
+			path->len--;
+			if (result != -1)
+				result = slash[1] ? glob_walk(data, path,
+						slash + 1, out) :
+					glob_push(data, path, NULL, out);
 		}
+		path->len = len;
 	}
-	/* Execute the command if no wildcard expansion occurred */
-	if (!wildcard_expanded)
-	{
-		parse_command(data);
-	}
+	return (result);
 }
 
+/**
+ * glob_push - adds a matched path to the command.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * @path: the path, terminated.
+ * @name: the name in the directory listing, for a path in the current
+ *		directory: it lasts longer than the command, and is not
+ *		copied. NULL to copy the path.
+ * @out: the words of the command being built.
+ * Return: 0 on success, -1 if memory ran out.
+ */
+int glob_push(shell_t *data, strbuf_t *path, char *name, strvec_t *out)
+{
+	char *copy;
+
+	if (name)
+		return (strvec_push(out, name));
+	copy = arena_strndup(&data->arena, path->s, path->len);
+	if (!copy)
+		return (-1);
+	return (strvec_push(out, copy));
+}
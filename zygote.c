@@ -0,0 +1,87 @@
+#include "shell.h"
+
+int zygote_start(shell_t *);
+pid_t spawn_zygote(shell_t *, char **, launch_t *, int *);
+void zygote_stop(shell_t *);
+
+/**
+ * zygote_start - starts the zygote: a process forked while the shell is
+ *		still small, which starts commands on the shell's behalf so
+ *		that the cost of a launch does not grow with the shell's heap.
+ * The zygote clones the commands with CLONE_PARENT, which makes them
+ *		children of the shell, waited for like any other.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * Return: 0 on success, -1 on failure.
+ */
+int zygote_start(shell_t *data)
+{
+	int sv[2];
+	pid_t pid;
+
+	if (data->zygote)
+		return (0);
+	if (socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, sv) == -1)
+		return (-1);
+	_putchar(BUF_FLUSH);
+	pid = fork();
+	if (pid == 0)
+	{
+		close(sv[0]);
+		zygote_serve(sv[1]);
+	}
+	close(sv[1]);
+	if (pid == -1)
+		return (close(sv[0]), -1);
+	data->zygote = pid;
+	data->zygote_fd = sv[0];
+	return (0);
+}
+
+/**
+ * spawn_zygote - the zygote backend: sends the command to the zygote,
+ *		which replies with its pid once it has exec'd, or with the
+ *		errno of a failed execve().
+ * Falls back to posix_spawn() when the zygote cannot be reached.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * @envp: the environment of the command.
+ * @launch: the child's standard file descriptors, or NULL.
+ * @err: receives the error of a failed spawn or exec.
+ * Return: the child's pid, or -1 on failure.
+ */
+pid_t spawn_zygote(shell_t *data, char **envp, launch_t *launch, int *err)
+{
+	int reply[2];
+
+	if (zygote_start(data) == -1 ||
+			zygote_send(data, envp, launch) == -1 ||
+			io_full(data->zygote_fd, reply, sizeof(reply), 0) == -1)
+	{
+		zygote_stop(data);
+		return (spawn_posix(data, envp, launch, err));
+	}
+	*err = reply[1];
+	if (reply[0] > 0 && *err)
+		waitpid(reply[0], NULL, 0);
+	if (reply[0] > 0 && !*err)
+		return (reply[0]);
+	if (!*err)
+		*err = EAGAIN;
+	return (-1);
+}
+
+/**
+ * zygote_stop - closes the socket to the zygote, which then exits,
+ *		and waits for it.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ */
+void zygote_stop(shell_t *data)
+{
+	if (!data->zygote)
+		return;
+	close(data->zygote_fd);
+	waitpid(data->zygote, NULL, 0);
+	data->zygote = 0;
+}
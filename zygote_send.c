@@ -0,0 +1,126 @@
+#include "shell.h"
+
+int zygote_send(shell_t *, char **, launch_t *);
+int zygote_msg(int, zyreq_t *, launch_t *, int);
+int io_full(int, void *, size_t, int);
+
+/**
+ * zygote_send - sends a launch request for data->path to the zygote:
+ *		the request, then the strings of the command in one block.
+ * The zygote was forked at startup, so the request carries the shell's
+ *		working directory and umask as they are now.
+ * @data: A pointer to the shell data structure,
+ *		which contains information about the current state of the shell.
+ * @envp: the environment of the command.
+ * @launch: the child's standard file descriptors, or NULL.
+ * Return: 0 on success, -1 on failure.
+ */
+int zygote_send(shell_t *data, char **envp, launch_t *launch)
+{
+	char *path[2], **lists[3], *blob, *p;
+	zyreq_t req;
+	int i, k, ret, cwd;
+
+	path[0] = data->path;
+	path[1] = NULL;
+	lists[0] = path;
+	lists[1] = data->argv;
+	lists[2] = envp;
+	memset(&req, 0, sizeof(req));
+	for (k = 0; k < 3; k++)
+		for (i = 0; lists[k][i]; i++)
+			req.len += _strlen(lists[k][i]) + 1;
+	for (i = 0; data->argv[i]; i++)
+		req.argc++;
+	for (i = 0; envp[i]; i++)
+		req.envc++;
+	blob = malloc(req.len);
+	if (!blob)
+		return (-1);
+	p = blob;
+	for (k = 0; k < 3; k++)
+		for (i = 0; lists[k][i]; i++)
+			p += _strlen(_strcpy(p, lists[k][i])) + 1;
+	cwd = open(".", O_PATH | O_DIRECTORY | O_CLOEXEC);
+	req.mask = umask(0);
+	umask(req.mask);
+	ret = cwd == -1 ? -1 : zygote_msg(data->zygote_fd, &req, launch, cwd);
+	if (ret != -1)
+		ret = io_full(data->zygote_fd, blob, req.len, 1);
+	if (cwd != -1)
+		close(cwd);
+	free(blob);
+	return (ret);
+}
+
+/**
+ * zygote_msg - sends a launch request, with the descriptors it installs
+ *		and the working directory attached as SCM_RIGHTS.
+ * @sock: the socket to the zygote.
+ * @req: the request, its fds bits still to set.
+ * @launch: the child's standard file descriptors, or NULL.
+ * @cwd: the working directory, opened with O_PATH.
+ * Return: 0 on success, -1 on failure.
+ */
+int zygote_msg(int sock, zyreq_t *req, launch_t *launch, int cwd)
+{
+	char ctl[CMSG_SPACE(4 * sizeof(int))];
+	struct msghdr msg;
+	struct cmsghdr *c;
+	struct iovec iov;
+	int i, fds[4], n = 0;
+
+	req->pgid = launch ? launch->pgid : -1;
+	req->tty = launch ? launch->tty : -1;
+	for (i = 0; launch && i < 3; i++)
+		if (launch->fd[i] != -1)
+		{
+			req->fds |= 1 << i;
+			fds[n++] = launch->fd[i];
+		}
+	req->fds |= 1 << ZYGOTE_CWD;
+	fds[n++] = cwd;
+	memset(&msg, 0, sizeof(msg));
+	iov.iov_base = req;
+	iov.iov_len = sizeof(*req);
+	msg.msg_iov = &iov;
+	msg.msg_iovlen = 1;
+	msg.msg_control = ctl;
+	msg.msg_controllen = CMSG_SPACE(n * sizeof(int));
+	c = CMSG_FIRSTHDR(&msg);
+	c->cmsg_level = SOL_SOCKET;
+	c->cmsg_type = SCM_RIGHTS;
+	c->cmsg_len = CMSG_LEN(n * sizeof(int));
+	memcpy(CMSG_DATA(c), fds, n * sizeof(int));
+	if (sendmsg(sock, &msg, MSG_NOSIGNAL) != (ssize_t)sizeof(*req))
+		return (-1);
+	return (0);
+}
+
+/**
+ * io_full - reads or writes a whole buffer on a socket, retrying
+ *		after short transfers and signals.
+ * Writes do not raise SIGPIPE when the other end is gone.
+ * @fd: the socket.
+ * @buf: the buffer.
+ * @len: its size.
+ * @out: non-zero to write the buffer, 0 to read it.
+ * Return: 0 on success, -1 on error or end of file.
+ */
+int io_full(int fd, void *buf, size_t len, int out)
+{
+	char *p = buf;
+	ssize_t n;
+
+	while (len)
+	{
+		n = out ? send(fd, p, len, MSG_NOSIGNAL) : recv(fd, p, len, 0);
+		if (n == -1 && errno == EINTR)
+			continue;
+		if (n <= 0)
+			return (-1);
+		p += n;
+		len -= n;
+	}
+	return (0);
+}
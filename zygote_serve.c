@@ -0,0 +1,171 @@
+#include "shell.h"
+#include <sys/syscall.h>
+#include <sched.h>
+
+void zygote_serve(int);
+int zygote_recv(int, zyreq_t *, int *, char **);
+void zygote_launch(zyreq_t *, int *, char *, int *);
+void zygote_exec(zyreq_t *, int *, char *, int);
+
+/**
+ * zygote_serve - the zygote's main loop: starts the commands the shell
+ *		asks for, until the shell closes its end of the socket.
+ * The zygote keeps only its socket and the standard descriptors,
+ *		and ignores the signals the terminal sends to the shell's
+ *		process group.
+ * @sock: the zygote's end of the socket.
+ */
+void zygote_serve(int sock)
+{
+	int fds[4], reply[2], i, fd, max = sysconf(_SC_OPEN_MAX);
+	zyreq_t req;
+	char *blob;
+
+	signal(SIGINT, SIG_IGN);
+	signal(SIGQUIT, SIG_IGN);
+	signal(SIGTSTP, SIG_IGN);
+	signal(SIGTTIN, SIG_IGN);
+	signal(SIGTTOU, SIG_IGN);
+	if (sock != 3 && dup3(sock, 3, O_CLOEXEC) != -1)
+		sock = 3; /* still close-on-exec, which dup2() would clear */
+#ifdef SYS_close_range
+	if (syscall(SYS_close_range, 4, ~0U, 0) == 0)
+		max = 0;
+#endif
+	for (fd = 4; fd < max && fd < 65536; fd++)
+		close(fd);
+	while (zygote_recv(sock, &req, fds, &blob) == 0)
+	{
+		zygote_launch(&req, fds, blob, reply);
+		for (i = 0; i <= ZYGOTE_CWD; i++)
+			if (fds[i] != -1)
+				close(fds[i]);
+		free(blob);
+		if (io_full(sock, reply, sizeof(reply), 1) == -1)
+			break;
+	}
+	_exit(0);
+}
+
+/**
+ * zygote_recv - receives a launch request, its descriptors and strings.
+ * @sock: the zygote's end of the socket.
+ * @req: receives the request.
+ * @fds: receives the descriptors to install as 0, 1 and 2, then the
+ *		working directory, -1 if none.
+ * @blob: receives the strings, to be freed.
+ * Return: 0 on success, -1 when the shell is gone.
+ */
+int zygote_recv(int sock, zyreq_t *req, int *fds, char **blob)
+{
+	char ctl[CMSG_SPACE(4 * sizeof(int))];
+	struct msghdr msg;
+	struct cmsghdr *c;
+	struct iovec iov;
+	int i, n = 0;
+
+	memset(&msg, 0, sizeof(msg));
+	iov.iov_base = req;
+	iov.iov_len = sizeof(*req);
+	msg.msg_iov = &iov;
+	msg.msg_iovlen = 1;
+	msg.msg_control = ctl;
+	msg.msg_controllen = sizeof(ctl);
+	fds[0] = fds[1] = fds[2] = fds[ZYGOTE_CWD] = -1;
+	*blob = NULL;
+	if (recvmsg(sock, &msg, MSG_CMSG_CLOEXEC) != (ssize_t)sizeof(*req))
+		return (-1);
+	c = CMSG_FIRSTHDR(&msg);
+	for (i = 0; i <= ZYGOTE_CWD; i++)
+		if ((req->fds & (1 << i)) && c && c->cmsg_type == SCM_RIGHTS &&
+				CMSG_LEN((n + 1) * sizeof(int)) <= c->cmsg_len)
+			memcpy(&fds[i], CMSG_DATA(c) + n++ * sizeof(int),
+					sizeof(int));
+	*blob = malloc(req->len);
+	if (!*blob || io_full(sock, *blob, req->len, 0) == -1)
+		return (-1);
+	return (0);
+}
+
+/**
+ * zygote_launch - starts a command as a child of the shell: a clone()
+ *		with CLONE_PARENT, so that the shell gets its SIGCHLD and
+ *		waits for it, stops and all, like any child of its own.
+ * The reply waits for the command's execve(): a close-on-exec pipe
+ *		stays open until then, and carries the errno of a failed one.
+ * The zygote has a single thread, so the raw clone() leaves no lock
+ *		of the C library held in the child.
+ * @req: the request.
+ * @fds: the descriptors of the request.
+ * @blob: the strings of the request.
+ * @reply: receives the command's pid, -1 if none, and an errno or 0.
+ */
+void zygote_launch(zyreq_t *req, int *fds, char *blob, int *reply)
+{
+	int gone[2];
+
+	reply[0] = -1;
+	reply[1] = 0;
+	if (pipe2(gone, O_CLOEXEC) == -1)
+	{
+		reply[1] = errno;
+		return;
+	}
+	reply[0] = syscall(SYS_clone, CLONE_PARENT | SIGCHLD, 0, 0, 0, 0);
+	if (reply[0] == 0)
+		zygote_exec(req, fds, blob, gone[1]);
+	if (reply[0] == -1)
+		reply[1] = errno;
+	close(gone[1]);
+	if (reply[0] > 0 && read(gone[0], &reply[1], sizeof(int)) <= 0)
+		reply[1] = 0;
+	close(gone[0]);
+}
+
+/**
+ * zygote_exec - the command's side of a launch: rebuilds its arguments
+ *		and environment, applies its launch, takes the shell's
+ *		working directory and umask, closes the zygote's socket
+ *		and execs it.
+ * @req: the request.
+ * @fds: the descriptors to install as 0, 1 and 2, then the working
+ *		directory.
+ * @blob: the strings of the request.
+ * @errfd: the pipe the errno of a failed execve() is written to.
+ */
+void zygote_exec(zyreq_t *req, int *fds, char *blob, int errfd)
+{
+	char *path = blob, **argv, **envp;
+	launch_t launch;
+	sigset_t none;
+	int i, err = ENOMEM;
+
+	argv = malloc(sizeof(char *) * (req->argc + req->envc + 2));
+	for (i = 0; argv && i < req->argc + req->envc; i++)
+	{
+		blob += _strlen(blob) + 1;
+		argv[i + (i >= req->argc)] = blob;
+	}
+	if (argv)
+	{
+		envp = argv + req->argc + 1;
+		argv[req->argc] = envp[req->envc] = NULL;
+		launch_init(&launch);
+		memcpy(launch.fd, fds, sizeof(launch.fd));
+		launch.pgid = req->pgid;
+		launch.tty = req->tty;
+		apply_launch(&launch);
+		for (i = 1; i < NSIG; i++)
+			signal(i, SIG_DFL); /* the zygote ignores some */
+		sigemptyset(&none);
+		sigprocmask(SIG_SETMASK, &none, NULL);
+		close(3); /* the zygote's socket is not the command's */
+		umask(req->mask);
+		if (fchdir(fds[ZYGOTE_CWD]) == 0)
+			execve(path, argv, envp);
+		err = errno;
+	}
+	if (write(errfd, &err, sizeof(err)) == -1)
+		err = EIO;
+	_exit(err == EACCES ? 126 : 1);
+}